@@ -1,13 +1,40 @@
 #include "thermal_core.h"
 #include "thermal_processing.h"
+#include "thermal_pipeline.h"
+#include "thermal_log.h"
+#include "thermal_arena.h"
 #include "sensors/mlx90640.h"
 #include "sensors/amg8833.h"
-#include "esp32_hal.h"
+#include "platform/platform_hal.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
 #define MAX_FRAME_SIZE 4096
+#define SCRATCH_BYTES (2 * THERMAL_ARENA_SIZE(MAX_FRAME_SIZE * sizeof(float)) + THERMAL_ARENA_SIZE(MAX_FRAME_SIZE * sizeof(rgb565_t)) + MLX90640_SCRATCH_SIZE)
+
+/* Frame buffers come from one static region instead of the stack; each test releases what it took. */
+static uint8_t scratch_storage[SCRATCH_BYTES];
+static thermal_arena_t scratch;
+
+static void *open_i2c_bus(void) {
+#ifdef ESP32_PLATFORM
+    platform_i2c_config_t i2c_config = {
+        .scl_pin = 22,
+        .sda_pin = 21,
+        .freq_hz = 400000,
+        .port = 0
+    };
+#else
+    platform_i2c_config_t i2c_config = {
+        .device = NULL,
+        .freq_hz = 400000,
+        .reg_addr_bytes = 0
+    };
+#endif
+    
+    return platform_i2c_init(&i2c_config);
+}
 
 static void print_frame_stats(const thermal_frame_t *frame) {
     thermal_minmax_t minmax;
@@ -49,16 +76,9 @@ static thermal_status_t test_mlx90640_sensor(void) {
     printf("\n--- Testing MLX90640 Sensor ---\n");
     fflush(stdout);
     
-    esp32_i2c_config_t i2c_config = {
-        .scl_pin = 22,
-        .sda_pin = 21,
-        .freq_hz = 400000,
-        .port = 0
-    };
-    
     printf("Initializing I2C hardware, Please wait.\n");
     fflush(stdout);
-    void *hw_handle = esp32_i2c_init(&i2c_config);
+    void *hw_handle = open_i2c_bus();
     printf("I2C hardware handle: %p\n", hw_handle);
     fflush(stdout);
     if (!hw_handle) {
@@ -74,17 +94,18 @@ static thermal_status_t test_mlx90640_sensor(void) {
     fflush(stdout);
     if (status != THERMAL_OK) {
         printf("Failed to create transport\n");
-        esp32_i2c_deinit(hw_handle);
+        platform_i2c_deinit(hw_handle);
         return status;
     }
     
     thermal_device_t device;
-    status = thermal_init(&device, &transport, &mlx90640_ops, MLX90640_I2C_ADDR);
+    status = thermal_init(&device, &transport, &mlx90640_ops, MLX90640_I2C_ADDR, &scratch);
+    thermal_log_flush();
     printf("thermal_init returned status: %d\n", status);
     fflush(stdout);
     if (status != THERMAL_OK) {
         printf("Failed to initialize thermal device\n");
-        esp32_i2c_deinit(hw_handle);
+        platform_i2c_deinit(hw_handle);
         return status;
     }
     
@@ -118,7 +139,15 @@ static thermal_status_t test_mlx90640_sensor(void) {
     
     printf("Allocating frame buffer, Please wait.\n");
     fflush(stdout);
-    float frame_buffer[MAX_FRAME_SIZE];
+    float *frame_buffer = thermal_arena_alloc(&scratch, MAX_FRAME_SIZE * sizeof(float));
+    float *interpolated_buffer = thermal_arena_alloc(&scratch, MAX_FRAME_SIZE * sizeof(float));
+    rgb565_t *colormap = thermal_arena_alloc(&scratch, MAX_FRAME_SIZE * sizeof(rgb565_t));
+    if (!frame_buffer || !interpolated_buffer || !colormap) {
+        printf("Scratch arena too small\n");
+        thermal_shutdown(&device);
+        platform_i2c_deinit(hw_handle);
+        return THERMAL_ERR_INVALID_ARG;
+    }
     printf("Frame buffer allocated\n");
     fflush(stdout);
     thermal_frame_t frame = {
@@ -152,7 +181,6 @@ static thermal_status_t test_mlx90640_sensor(void) {
     
     printf("Setting up interpolation buffers, Please wait.\n");
     fflush(stdout);
-    float interpolated_buffer[MAX_FRAME_SIZE];
     thermal_resolution_t high_res = {64, 48};
     
     printf("Calling bilinear interpolation, Please wait.\n");
@@ -166,7 +194,6 @@ static thermal_status_t test_mlx90640_sensor(void) {
                high_res.width, high_res.height);
     }
     
-    rgb565_t colormap[MAX_FRAME_SIZE];
     status = thermal_apply_colormap(frame.data, &frame.resolution, 20.0f, 40.0f, colormap);
     if (status == THERMAL_OK) {
         printf("Colormap applied (%zu pixels)\n", 
@@ -174,7 +201,7 @@ static thermal_status_t test_mlx90640_sensor(void) {
     }
     
     status = thermal_shutdown(&device);
-    esp32_i2c_deinit(hw_handle);
+    platform_i2c_deinit(hw_handle);
     
     printf("MLX90640 test completed\n");
     return THERMAL_OK;
@@ -183,14 +210,7 @@ static thermal_status_t test_mlx90640_sensor(void) {
 static thermal_status_t test_amg8833_sensor(void) {
     printf("\n--- Testing AMG8833 Sensor ---\n");
     
-    esp32_i2c_config_t i2c_config = {
-        .scl_pin = 22,
-        .sda_pin = 21,
-        .freq_hz = 400000,
-        .port = 0
-    };
-    
-    void *hw_handle = esp32_i2c_init(&i2c_config);
+    void *hw_handle = open_i2c_bus();
     if (!hw_handle) {
         printf("Failed to initialize I2C hardware\n");
         return THERMAL_ERR_IO;
@@ -200,15 +220,16 @@ static thermal_status_t test_amg8833_sensor(void) {
     thermal_status_t status = i2c_transport_create(&transport, hw_handle);
     if (status != THERMAL_OK) {
         printf("Failed to create transport\n");
-        esp32_i2c_deinit(hw_handle);
+        platform_i2c_deinit(hw_handle);
         return status;
     }
     
     thermal_device_t device;
-    status = thermal_init(&device, &transport, &amg8833_ops, AMG8833_I2C_ADDR);
+    status = thermal_init(&device, &transport, &amg8833_ops, AMG8833_I2C_ADDR, &scratch);
+    thermal_log_flush();
     if (status != THERMAL_OK) {
         printf("Failed to initialize thermal device\n");
-        esp32_i2c_deinit(hw_handle);
+        platform_i2c_deinit(hw_handle);
         return status;
     }
     
@@ -228,7 +249,15 @@ static thermal_status_t test_amg8833_sensor(void) {
         printf("Self-test completed\n");
     }
     
-    float frame_buffer[MAX_FRAME_SIZE];
+    float *frame_buffer = thermal_arena_alloc(&scratch, MAX_FRAME_SIZE * sizeof(float));
+    float *filtered_buffer = thermal_arena_alloc(&scratch, MAX_FRAME_SIZE * sizeof(float));
+    if (!frame_buffer || !filtered_buffer) {
+        printf("Scratch arena too small\n");
+        thermal_shutdown(&device);
+        platform_i2c_deinit(hw_handle);
+        return THERMAL_ERR_INVALID_ARG;
+    }
+    
     thermal_frame_t frame = {
         .data = frame_buffer,
         .resolution = {0, 0},
@@ -244,36 +273,107 @@ static thermal_status_t test_amg8833_sensor(void) {
         }
     }
     
-    float filtered_buffer[MAX_FRAME_SIZE];
-    status = thermal_median_filter(frame.data, &frame.resolution, filtered_buffer, 3);
+    status = thermal_median_filter(frame.data, &frame.resolution, filtered_buffer, 3, &scratch);
     if (status == THERMAL_OK) {
         printf("Median filter applied (3x3 kernel)\n");
     }
     
     status = thermal_shutdown(&device);
-    esp32_i2c_deinit(hw_handle);
+    platform_i2c_deinit(hw_handle);
     
     printf("AMG8833 test completed\n");
     return THERMAL_OK;
 }
 
+static thermal_status_t test_pipeline(void) {
+    printf("\n--- Testing Acquisition Pipeline ---\n");
+    
+    void *hw_handle = open_i2c_bus();
+    if (!hw_handle) {
+        printf("Failed to initialize I2C hardware\n");
+        return THERMAL_ERR_IO;
+    }
+    
+    thermal_transport_t transport;
+    thermal_status_t status = i2c_transport_create(&transport, hw_handle);
+    if (status != THERMAL_OK) {
+        platform_i2c_deinit(hw_handle);
+        return status;
+    }
+    
+    thermal_device_t device;
+    status = thermal_init(&device, &transport, &amg8833_ops, AMG8833_I2C_ADDR, &scratch);
+    if (status != THERMAL_OK) {
+        platform_i2c_deinit(hw_handle);
+        return status;
+    }
+    
+    static float pool_storage[AMG8833_PIXELS * 4];
+    static thermal_pipeline_t pipeline;
+    status = thermal_pipeline_init(&pipeline, &device, pool_storage, AMG8833_PIXELS * 4, THERMAL_DROP_OLDEST, 10);
+    if (status == THERMAL_OK) {
+        status = thermal_pipeline_start(&pipeline);
+    }
+    
+    if (status == THERMAL_ERR_UNSUPPORTED) {
+        printf("Acquisition task not available on this platform\n");
+    } else if (status == THERMAL_OK) {
+        for (int i = 0; i < 5; i++) {
+            thermal_frame_t *frame;
+            if (thermal_pipeline_acquire(&pipeline, &frame, 500000) == THERMAL_OK) {
+                print_frame_stats(frame);
+                thermal_pipeline_release(&pipeline, frame);
+            }
+        }
+        
+        thermal_pipeline_stop(&pipeline);
+        
+        thermal_pipeline_stats_t stats;
+        thermal_pipeline_get_stats(&pipeline, &stats);
+        printf("Pipeline: acquired=%u delivered=%u dropped_oldest=%u dropped_newest=%u errors=%u\n",
+               stats.acquired, stats.delivered, stats.dropped_oldest, stats.dropped_newest, stats.errors);
+    }
+    
+    thermal_shutdown(&device);
+    platform_i2c_deinit(hw_handle);
+    
+    printf("Pipeline test completed\n");
+    return status;
+}
+
 int main(void) {
     printf("Framework Example for TID(Thermal Imaging Driver)\nDeveloped by Brandon | Github; A31A18B25C9D012/TID\n");
     printf("-------------------------------------------------\n");
     fflush(stdout);
     
     thermal_status_t status;
+    size_t mark;
     
+    thermal_arena_init(&scratch, scratch_storage, sizeof(scratch_storage));
+    
+    mark = thermal_arena_mark(&scratch);
     status = test_mlx90640_sensor();
+    thermal_arena_release(&scratch, mark);
+    thermal_log_flush();
     if (status != THERMAL_OK) {
         printf("MLX90640 test failed with status %d\n", status);
     }
     
+    mark = thermal_arena_mark(&scratch);
     status = test_amg8833_sensor();
+    thermal_arena_release(&scratch, mark);
+    thermal_log_flush();
     if (status != THERMAL_OK) {
         printf("AMG8833 test failed with status %d\n", status);
     }
     
+    status = test_pipeline();
+    thermal_log_flush();
+    if (status != THERMAL_OK && status != THERMAL_ERR_UNSUPPORTED) {
+        printf("Pipeline test failed with status %d\n", status);
+    }
+    
+    printf("Scratch arena high water: %zu of %zu bytes\n", scratch.high_water, scratch.size);
     printf("\nAll tests completed\n");
     return 0;
 }
@@ -1,12 +1,76 @@
 #ifndef PLATFORM_HAL_H
 #define PLATFORM_HAL_H
 
-#ifdef ESP32_PLATFORM
+#include <stdatomic.h>
+
+#if defined(ESP32_PLATFORM)
 #include "esp32/esp32_hal.h"
+
+typedef esp32_i2c_config_t platform_i2c_config_t;
+typedef esp32_spi_config_t platform_spi_config_t;
+typedef esp32_thread_t platform_thread_t;
+typedef esp32_mutex_t platform_mutex_t;
+
+#define platform_i2c_init esp32_i2c_init
+#define platform_i2c_deinit esp32_i2c_deinit
+#define platform_i2c_read esp32_i2c_read
+#define platform_i2c_write esp32_i2c_write
+#define platform_i2c_read_burst esp32_i2c_read_burst
+#define platform_spi_init esp32_spi_init
+#define platform_spi_deinit esp32_spi_deinit
+#define platform_spi_read esp32_spi_read
+#define platform_spi_write esp32_spi_write
+#define platform_spi_read_burst esp32_spi_read_burst
+#define platform_time_us esp32_time_us
+#define platform_sleep_us esp32_sleep_us
+#define platform_sleep_until_us esp32_sleep_until_us
+#define platform_thread_create esp32_thread_create
+#define platform_thread_join esp32_thread_join
+#define platform_mutex_init esp32_mutex_init
+#define platform_mutex_lock esp32_mutex_lock
+#define platform_mutex_unlock esp32_mutex_unlock
+#define platform_mutex_destroy esp32_mutex_destroy
+
+#elif defined(POSIX_PLATFORM)
+#include "posix/posix_hal.h"
+
+typedef posix_i2c_config_t platform_i2c_config_t;
+typedef posix_spi_config_t platform_spi_config_t;
+typedef posix_thread_t platform_thread_t;
+typedef posix_mutex_t platform_mutex_t;
+
+#define platform_i2c_init posix_i2c_init
+#define platform_i2c_deinit posix_i2c_deinit
+#define platform_i2c_read posix_i2c_read
+#define platform_i2c_write posix_i2c_write
+#define platform_i2c_read_burst posix_i2c_read_burst
+#define platform_spi_init posix_spi_init
+#define platform_spi_deinit posix_spi_deinit
+#define platform_spi_read posix_spi_read
+#define platform_spi_write posix_spi_write
+#define platform_spi_read_burst posix_spi_read_burst
+#define platform_time_us posix_time_us
+#define platform_sleep_us posix_sleep_us
+#define platform_sleep_until_us posix_sleep_until_us
+#define platform_thread_create posix_thread_create
+#define platform_thread_join posix_thread_join
+#define platform_mutex_init posix_mutex_init
+#define platform_mutex_lock posix_mutex_lock
+#define platform_mutex_unlock posix_mutex_unlock
+#define platform_mutex_destroy posix_mutex_destroy
+
 #else
 #error "No platform selected"
 #endif
 
+typedef atomic_uint_least32_t platform_atomic_u32_t;
+
+#define platform_atomic_load(obj) atomic_load_explicit((obj), memory_order_acquire)
+#define platform_atomic_store(obj, value) atomic_store_explicit((obj), (value), memory_order_release)
+#define platform_atomic_fetch_add(obj, value) atomic_fetch_add_explicit((obj), (value), memory_order_acq_rel)
+#define platform_atomic_cas(obj, expected, desired) \
+    atomic_compare_exchange_strong_explicit((obj), (expected), (desired), memory_order_acq_rel, memory_order_acquire)
+
 #endif
 
 /*
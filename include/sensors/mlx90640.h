@@ -8,6 +8,9 @@
 #define MLX90640_HEIGHT 24
 #define MLX90640_PIXELS (MLX90640_WIDTH * MLX90640_HEIGHT)
 
+/* Scratch bytes each device takes from its arena: the 832-word EEPROM read at init, reused for frame RAM. */
+#define MLX90640_SCRATCH_SIZE THERMAL_ARENA_SIZE(832 * sizeof(uint16_t))
+
 extern const sensor_ops_t mlx90640_ops;
 
 #endif
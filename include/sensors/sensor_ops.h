@@ -3,15 +3,18 @@
 
 #include "thermal_types.h"
 #include "thermal_transport.h"
+#include "thermal_arena.h"
 
 typedef struct sensor_ops sensor_ops_t;
 
-typedef thermal_status_t (*sensor_init_fn)(thermal_transport_t *transport, uint8_t dev_addr);
-typedef thermal_status_t (*sensor_get_frame_fn)(thermal_transport_t *transport, uint8_t dev_addr, float *buffer, size_t buf_size);
+typedef thermal_status_t (*sensor_init_fn)(thermal_transport_t *transport, uint8_t dev_addr, thermal_arena_t *scratch);
+typedef thermal_status_t (*sensor_get_frame_fn)(thermal_transport_t *transport, uint8_t dev_addr, float *buffer, size_t buf_size, thermal_arena_t *scratch);
 typedef thermal_status_t (*sensor_get_resolution_fn)(thermal_resolution_t *resolution);
 typedef thermal_status_t (*sensor_set_refresh_rate_fn)(thermal_transport_t *transport, uint8_t dev_addr, uint8_t rate_hz);
 typedef thermal_status_t (*sensor_self_test_fn)(thermal_transport_t *transport, uint8_t dev_addr);
 typedef thermal_status_t (*sensor_shutdown_fn)(thermal_transport_t *transport, uint8_t dev_addr);
+/* Bad-pixel maps are driver state, like calibration, so they apply to every device on that driver. */
+typedef thermal_status_t (*sensor_set_bad_pixels_fn)(const uint16_t *indices, uint8_t count);
 
 struct sensor_ops {
     const char *name;
@@ -21,6 +24,11 @@ struct sensor_ops {
     sensor_set_refresh_rate_fn set_refresh_rate;
     sensor_self_test_fn self_test;
     sensor_shutdown_fn shutdown;
+    sensor_set_bad_pixels_fn set_bad_pixels;
+    const uint8_t *refresh_rates;
+    uint8_t refresh_rate_count;
+    /* Worst-case bytes init and get_frame take from the device's scratch arena; 0 if they need none. */
+    size_t scratch_size;
 };
 
 #endif
@@ -0,0 +1,92 @@
+#ifndef THERMAL_ALARM_H
+#define THERMAL_ALARM_H
+
+#include "thermal_types.h"
+
+#define THERMAL_ALARM_MAX_ZONES 16
+#define THERMAL_ALARM_MAX_HISTORIES 8
+#define THERMAL_ALARM_HISTORY_SAMPLES 32
+
+typedef enum {
+    THERMAL_ALARM_STAT_MIN,
+    THERMAL_ALARM_STAT_MAX,
+    THERMAL_ALARM_STAT_MEAN,
+    THERMAL_ALARM_STAT_COUNT
+} thermal_alarm_stat_t;
+
+typedef enum {
+    THERMAL_ALARM_ABOVE,
+    THERMAL_ALARM_BELOW
+} thermal_alarm_compare_t;
+
+/*
+ * A level rule (window_ms == 0) tests the zone statistic itself; a rate rule tests how much it changed over
+ * the last window_ms, so "rose 3 C within 10 s" is ABOVE 3.0 with a 10000 ms window. The condition must hold
+ * for hold_frames consecutive frames to raise, and fail by more than hysteresis for as many frames to clear.
+ */
+typedef struct {
+    uint8_t zone;
+    thermal_alarm_stat_t stat;
+    thermal_alarm_compare_t compare;
+    float threshold;
+    float hysteresis;
+    uint16_t hold_frames;
+    uint32_t window_ms;
+} thermal_alarm_rule_t;
+
+/* One compiled rule plus its running state; the caller provides one per rule. */
+typedef struct {
+    float threshold;
+    float release;
+    uint32_t window_ms;
+    uint32_t cursor;
+    uint16_t hold_frames;
+    uint16_t count;
+    uint8_t opcode;
+    uint8_t zone;
+    uint8_t stat;
+    uint8_t history;
+    uint8_t active;
+} thermal_alarm_op_t;
+
+/* Samples of one zone statistic for one window length, shared by the rate rules that use it and spaced window_ms / 30 apart. */
+typedef struct {
+    uint8_t zone;
+    uint8_t stat;
+    uint32_t window_ms;
+    uint32_t interval_ms;
+    uint32_t written;
+    uint32_t time_ms[THERMAL_ALARM_HISTORY_SAMPLES];
+    float value[THERMAL_ALARM_HISTORY_SAMPLES];
+} thermal_alarm_history_t;
+
+typedef struct {
+    uint16_t rule;
+    uint8_t raised;
+    float value;
+} thermal_alarm_event_t;
+
+typedef struct {
+    thermal_resolution_t resolution;
+    thermal_rect_t zones[THERMAL_ALARM_MAX_ZONES];
+    uint8_t zone_count;
+    uint16_t zone_used;
+    float stats[THERMAL_ALARM_MAX_ZONES][THERMAL_ALARM_STAT_COUNT];
+    thermal_alarm_history_t histories[THERMAL_ALARM_MAX_HISTORIES];
+    uint8_t history_count;
+    thermal_alarm_op_t *program;
+    size_t rule_count;
+    uint32_t dropped_events;
+} thermal_alarm_t;
+
+thermal_status_t thermal_alarm_compile(thermal_alarm_t *alarm, const thermal_resolution_t *resolution, const thermal_rect_t *zones, uint8_t zone_count, const thermal_alarm_rule_t *rules, size_t rule_count, thermal_alarm_op_t *program, size_t program_capacity);
+thermal_status_t thermal_alarm_update(thermal_alarm_t *alarm, const thermal_frame_t *frame, uint32_t now_ms, thermal_alarm_event_t *events, size_t max_events, size_t *event_count);
+uint8_t thermal_alarm_active(const thermal_alarm_t *alarm, size_t rule);
+void thermal_alarm_reset(thermal_alarm_t *alarm);
+
+#endif
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
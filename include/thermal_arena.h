@@ -0,0 +1,31 @@
+#ifndef THERMAL_ARENA_H
+#define THERMAL_ARENA_H
+
+#include "thermal_types.h"
+
+#define THERMAL_ARENA_ALIGN 8
+#define THERMAL_ARENA_SIZE(bytes) (((size_t)(bytes) + THERMAL_ARENA_ALIGN - 1) & ~(size_t)(THERMAL_ARENA_ALIGN - 1))
+
+/*
+ * Bump allocator over one caller region (static array, PSRAM, ...). Nothing is freed individually:
+ * take a mark before a batch of allocations and release back to it afterwards.
+ */
+typedef struct {
+    uint8_t *base;
+    size_t size;
+    size_t used;
+    size_t high_water;
+} thermal_arena_t;
+
+thermal_status_t thermal_arena_init(thermal_arena_t *arena, void *buffer, size_t size);
+void *thermal_arena_alloc(thermal_arena_t *arena, size_t bytes);
+size_t thermal_arena_mark(const thermal_arena_t *arena);
+void thermal_arena_release(thermal_arena_t *arena, size_t mark);
+void thermal_arena_reset(thermal_arena_t *arena);
+
+#endif
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
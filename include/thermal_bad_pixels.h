@@ -0,0 +1,29 @@
+#ifndef THERMAL_BAD_PIXELS_H
+#define THERMAL_BAD_PIXELS_H
+
+#include "thermal_types.h"
+
+#define THERMAL_BAD_PIXELS_MAX 16
+#define THERMAL_BAD_PIXEL_NEIGHBORS 4
+
+typedef struct {
+    uint16_t index;
+    uint8_t neighbor_count;
+    uint16_t neighbors[THERMAL_BAD_PIXEL_NEIGHBORS];
+} thermal_bad_pixel_t;
+
+/* Built once from the bad-pixel list; applying it touches only the listed pixels and their neighbours. */
+typedef struct {
+    thermal_bad_pixel_t pixels[THERMAL_BAD_PIXELS_MAX];
+    uint8_t count;
+} thermal_bad_pixel_map_t;
+
+thermal_status_t thermal_bad_pixels_build(thermal_bad_pixel_map_t *map, const thermal_resolution_t *resolution, const uint16_t *indices, uint8_t count);
+void thermal_bad_pixels_apply(const thermal_bad_pixel_map_t *map, float *frame);
+
+#endif
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
@@ -0,0 +1,38 @@
+#ifndef THERMAL_CHANGE_H
+#define THERMAL_CHANGE_H
+
+#include "thermal_types.h"
+
+#define THERMAL_CHANGE_BLOCK_SIZE 8
+
+/* reference holds the last frame reported as changed, so slow drift still trips the tolerance eventually. */
+typedef struct {
+    float tolerance;
+    float *reference;
+    size_t reference_len;
+    thermal_resolution_t resolution;
+    uint8_t has_reference;
+    uint32_t last_block;
+    uint32_t changed_frames;
+    uint32_t unchanged_frames;
+} thermal_change_detector_t;
+
+/* Consumer side: the id (timestamp) of the last frame the consumer processed. */
+typedef struct {
+    uint32_t last_id;
+    uint8_t has_last;
+    uint32_t forced_frames;
+} thermal_change_cursor_t;
+
+thermal_status_t thermal_change_init(thermal_change_detector_t *detector, float tolerance, float *reference, size_t reference_len);
+thermal_status_t thermal_change_check(thermal_change_detector_t *detector, const thermal_frame_t *frame, uint8_t *changed);
+void thermal_change_reset(thermal_change_detector_t *detector);
+void thermal_change_cursor_reset(thermal_change_cursor_t *cursor);
+thermal_status_t thermal_change_consume(thermal_change_cursor_t *cursor, thermal_frame_t *frame);
+
+#endif
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
@@ -0,0 +1,39 @@
+#ifndef THERMAL_CODEC_H
+#define THERMAL_CODEC_H
+
+#include "thermal_types.h"
+
+#define THERMAL_CODEC_MAGIC 0x54
+#define THERMAL_CODEC_HEADER_SIZE 10
+#define THERMAL_CODEC_FLAG_KEYFRAME 0x01
+#define THERMAL_CODEC_MAX_WIDTH 128
+
+typedef struct {
+    float step;
+    uint16_t keyframe_interval;
+} thermal_codec_config_t;
+
+/* One instance per stream direction; history holds the last quantized frame and is caller-provided. */
+typedef struct {
+    thermal_resolution_t resolution;
+    uint16_t step_mdeg;
+    uint16_t keyframe_interval;
+    uint16_t frames_since_key;
+    uint16_t sequence;
+    uint8_t has_history;
+    int32_t *history;
+    int32_t row[THERMAL_CODEC_MAX_WIDTH];
+} thermal_codec_t;
+
+thermal_status_t thermal_codec_init(thermal_codec_t *codec, const thermal_codec_config_t *config, const thermal_resolution_t *resolution, int32_t *history, size_t history_len);
+size_t thermal_codec_max_encoded_size(const thermal_resolution_t *resolution);
+thermal_status_t thermal_codec_encode(thermal_codec_t *codec, const thermal_frame_t *frame, uint8_t *out, size_t out_size, size_t *out_len);
+thermal_status_t thermal_codec_decode(thermal_codec_t *codec, const uint8_t *in, size_t in_len, thermal_frame_t *frame);
+void thermal_codec_force_keyframe(thermal_codec_t *codec);
+
+#endif
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
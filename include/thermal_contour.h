@@ -0,0 +1,42 @@
+#ifndef THERMAL_CONTOUR_H
+#define THERMAL_CONTOUR_H
+
+#include "thermal_types.h"
+#include "thermal_arena.h"
+
+#define THERMAL_CONTOUR_MAX_LEVELS 16
+
+/* Positions are in source pixel units; (0, 0) is the centre of the top-left pixel. */
+typedef struct {
+    float x;
+    float y;
+} thermal_point_t;
+
+/* points[first .. first + count) of the set; a closed line repeats its first point at the end. */
+typedef struct {
+    uint32_t first;
+    uint16_t count;
+    uint8_t level;
+    uint8_t closed;
+} thermal_polyline_t;
+
+/* Caller-owned output; truncated is set when either buffer filled up before every contour was traced. */
+typedef struct {
+    thermal_point_t *points;
+    size_t point_capacity;
+    size_t point_count;
+    thermal_polyline_t *lines;
+    size_t line_capacity;
+    size_t line_count;
+    uint8_t truncated;
+} thermal_contour_set_t;
+
+size_t thermal_contour_scratch_size(const thermal_resolution_t *resolution);
+thermal_status_t thermal_contour_extract(const thermal_frame_t *frame, const float *levels, uint8_t level_count, thermal_contour_set_t *contours, thermal_arena_t *scratch);
+
+#endif
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
@@ -4,19 +4,28 @@
 #include "thermal_types.h"
 #include "thermal_transport.h"
 #include "sensors/sensor_ops.h"
+#include "thermal_change.h"
 
 typedef struct {
     thermal_transport_t *transport;
     const sensor_ops_t *sensor_ops;
     uint8_t device_addr;
     thermal_resolution_t resolution;
+    uint8_t refresh_rate_hz;
+    uint32_t frame_counter;
+    thermal_change_detector_t *change_detector;
+    thermal_arena_t *scratch;
     uint8_t initialized;
 } thermal_device_t;
 
-thermal_status_t thermal_init(thermal_device_t *device, thermal_transport_t *transport, const sensor_ops_t *sensor_ops, uint8_t dev_addr);
+thermal_status_t thermal_init(thermal_device_t *device, thermal_transport_t *transport, const sensor_ops_t *sensor_ops, uint8_t dev_addr, thermal_arena_t *scratch);
+size_t thermal_sensor_scratch_size(const sensor_ops_t *sensor_ops);
 thermal_status_t thermal_get_frame(thermal_device_t *device, thermal_frame_t *frame);
 thermal_status_t thermal_get_resolution(thermal_device_t *device, thermal_resolution_t *resolution);
 thermal_status_t thermal_set_refresh_rate(thermal_device_t *device, uint8_t rate_hz);
+thermal_status_t thermal_get_refresh_rates(thermal_device_t *device, const uint8_t **rates, uint8_t *count);
+thermal_status_t thermal_set_bad_pixels(thermal_device_t *device, const uint16_t *indices, uint8_t count);
+thermal_status_t thermal_set_change_detector(thermal_device_t *device, thermal_change_detector_t *detector);
 thermal_status_t thermal_self_test(thermal_device_t *device);
 thermal_status_t thermal_shutdown(thermal_device_t *device);
 
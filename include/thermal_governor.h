@@ -0,0 +1,41 @@
+#ifndef THERMAL_GOVERNOR_H
+#define THERMAL_GOVERNOR_H
+
+#include "thermal_core.h"
+
+/* Thresholds are per-frame mean absolute change in °C; raise_threshold should sit above lower_threshold. */
+typedef struct {
+    uint8_t min_rate_hz;
+    uint8_t max_rate_hz;
+    float raise_threshold;
+    float lower_threshold;
+    uint8_t motion_pixels;
+    uint16_t lower_frames;
+} thermal_governor_config_t;
+
+typedef struct {
+    thermal_device_t *device;
+    thermal_governor_config_t config;
+    const uint8_t *rates;
+    uint8_t level_min;
+    uint8_t level_max;
+    uint8_t level;
+    float *reference;
+    uint8_t has_reference;
+    uint16_t quiet_frames;
+    uint16_t hot_x;
+    uint16_t hot_y;
+    float activity;
+    uint32_t rate_changes;
+} thermal_governor_t;
+
+thermal_status_t thermal_governor_init(thermal_governor_t *gov, thermal_device_t *device, const thermal_governor_config_t *config, float *reference, size_t reference_len);
+thermal_status_t thermal_governor_update(thermal_governor_t *gov, const thermal_frame_t *frame, uint8_t *rate_changed);
+uint8_t thermal_governor_rate(const thermal_governor_t *gov);
+
+#endif
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
@@ -0,0 +1,44 @@
+#ifndef THERMAL_INCREMENTAL_H
+#define THERMAL_INCREMENTAL_H
+
+#include "thermal_types.h"
+
+#define THERMAL_INCREMENTAL_MAX_TILES 128
+
+/*
+ * Source frames are split into square tiles; each source tile owns the display
+ * pixels whose bilinear top-left tap falls inside it. reference holds the
+ * source values the display was last rendered from, upscaled and image the
+ * persistent display output; all three are caller buffers sized from the
+ * resolutions.
+ */
+typedef struct {
+    thermal_resolution_t src_res;
+    thermal_resolution_t dst_res;
+    float tolerance;
+    float *reference;
+    float *upscaled;
+    rgb565_t *image;
+    float min_temp;
+    float max_temp;
+    uint8_t valid;
+    uint8_t tile_size;
+    uint8_t tiles_x;
+    uint8_t tiles_y;
+    uint16_t dst_col[THERMAL_INCREMENTAL_MAX_TILES + 1];
+    uint16_t dst_row[THERMAL_INCREMENTAL_MAX_TILES + 1];
+    uint8_t dirty[THERMAL_INCREMENTAL_MAX_TILES];
+    thermal_rect_t rects[THERMAL_INCREMENTAL_MAX_TILES];
+    uint16_t rect_count;
+} thermal_incremental_t;
+
+thermal_status_t thermal_incremental_init(thermal_incremental_t *inc, const thermal_resolution_t *src_res, const thermal_resolution_t *dst_res, float tolerance, float *reference, float *upscaled, rgb565_t *image);
+thermal_status_t thermal_incremental_render(thermal_incremental_t *inc, const thermal_frame_t *frame, float min_temp, float max_temp, const thermal_rect_t **rects, uint16_t *rect_count);
+void thermal_incremental_invalidate(thermal_incremental_t *inc);
+
+#endif
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
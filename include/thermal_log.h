@@ -0,0 +1,144 @@
+#ifndef THERMAL_LOG_H
+#define THERMAL_LOG_H
+
+#include "thermal_types.h"
+
+#define THERMAL_LOG_LEVEL_NONE 0
+#define THERMAL_LOG_LEVEL_ERROR 1
+#define THERMAL_LOG_LEVEL_WARN 2
+#define THERMAL_LOG_LEVEL_INFO 3
+#define THERMAL_LOG_LEVEL_DEBUG 4
+
+/* Messages above this level are removed by the preprocessor, arguments included. */
+#ifndef THERMAL_LOG_LEVEL
+#define THERMAL_LOG_LEVEL THERMAL_LOG_LEVEL_INFO
+#endif
+
+#define THERMAL_LOG_MAX_ARGS 4
+#define THERMAL_LOG_RING_SIZE 64
+#define THERMAL_LOG_LINE_MAX 160
+
+typedef enum {
+    THERMAL_LOG_ARG_INT,
+    THERMAL_LOG_ARG_UINT,
+    THERMAL_LOG_ARG_DOUBLE,
+    THERMAL_LOG_ARG_STR,
+    THERMAL_LOG_ARG_PTR
+} thermal_log_arg_type_t;
+
+typedef struct {
+    uint8_t type;
+    union {
+        uint64_t u;
+        double d;
+        const char *s;
+        const void *p;
+    } value;
+} thermal_log_arg_t;
+
+/* The format string pointer doubles as the message ID; it and any %s argument must be static. */
+typedef struct {
+    const char *fmt;
+    uint64_t timestamp_us;
+    uint8_t level;
+    uint8_t arg_count;
+    thermal_log_arg_t args[THERMAL_LOG_MAX_ARGS];
+} thermal_log_record_t;
+
+typedef void (*thermal_log_sink_fn)(uint8_t level, uint64_t timestamp_us, const char *text);
+
+void thermal_log_write(uint8_t level, const char *fmt, uint8_t arg_count, const thermal_log_arg_t *args);
+size_t thermal_log_flush(void);
+size_t thermal_log_format(const thermal_log_record_t *record, char *buffer, size_t buf_size);
+void thermal_log_set_sink(thermal_log_sink_fn sink);
+uint32_t thermal_log_dropped(void);
+
+static inline thermal_log_arg_t thermal_log_arg_int(long long v) {
+    thermal_log_arg_t arg = { .type = THERMAL_LOG_ARG_INT, .value.u = (uint64_t)v };
+    return arg;
+}
+
+static inline thermal_log_arg_t thermal_log_arg_uint(unsigned long long v) {
+    thermal_log_arg_t arg = { .type = THERMAL_LOG_ARG_UINT, .value.u = (uint64_t)v };
+    return arg;
+}
+
+static inline thermal_log_arg_t thermal_log_arg_double(double v) {
+    thermal_log_arg_t arg = { .type = THERMAL_LOG_ARG_DOUBLE, .value.d = v };
+    return arg;
+}
+
+static inline thermal_log_arg_t thermal_log_arg_str(const char *v) {
+    thermal_log_arg_t arg = { .type = THERMAL_LOG_ARG_STR, .value.s = v };
+    return arg;
+}
+
+static inline thermal_log_arg_t thermal_log_arg_ptr(const void *v) {
+    thermal_log_arg_t arg = { .type = THERMAL_LOG_ARG_PTR, .value.p = v };
+    return arg;
+}
+
+/* Pointers other than strings must be cast to (void *) or (const void *). */
+#define THERMAL_LOG_ARG(x) _Generic((x), \
+    float: thermal_log_arg_double, \
+    double: thermal_log_arg_double, \
+    char *: thermal_log_arg_str, \
+    const char *: thermal_log_arg_str, \
+    void *: thermal_log_arg_ptr, \
+    const void *: thermal_log_arg_ptr, \
+    signed char: thermal_log_arg_int, \
+    short: thermal_log_arg_int, \
+    int: thermal_log_arg_int, \
+    long: thermal_log_arg_int, \
+    long long: thermal_log_arg_int, \
+    default: thermal_log_arg_uint)(x)
+
+#define THERMAL_LOG_CAT_(a, b) a##b
+#define THERMAL_LOG_CAT(a, b) THERMAL_LOG_CAT_(a, b)
+#define THERMAL_LOG_NARGS_(_0, _1, _2, _3, _4, n, ...) n
+#define THERMAL_LOG_NARGS(...) THERMAL_LOG_NARGS_(__VA_ARGS__, 4, 3, 2, 1, 0, 0)
+
+#define THERMAL_LOG_EMIT_0(level, fmt) \
+    thermal_log_write((level), (fmt), 0, NULL)
+#define THERMAL_LOG_EMIT_1(level, fmt, a) \
+    thermal_log_write((level), (fmt), 1, (const thermal_log_arg_t[]){ THERMAL_LOG_ARG(a) })
+#define THERMAL_LOG_EMIT_2(level, fmt, a, b) \
+    thermal_log_write((level), (fmt), 2, (const thermal_log_arg_t[]){ THERMAL_LOG_ARG(a), THERMAL_LOG_ARG(b) })
+#define THERMAL_LOG_EMIT_3(level, fmt, a, b, c) \
+    thermal_log_write((level), (fmt), 3, (const thermal_log_arg_t[]){ THERMAL_LOG_ARG(a), THERMAL_LOG_ARG(b), THERMAL_LOG_ARG(c) })
+#define THERMAL_LOG_EMIT_4(level, fmt, a, b, c, d) \
+    thermal_log_write((level), (fmt), 4, (const thermal_log_arg_t[]){ THERMAL_LOG_ARG(a), THERMAL_LOG_ARG(b), THERMAL_LOG_ARG(c), THERMAL_LOG_ARG(d) })
+
+#define THERMAL_LOG_EMIT(level, ...) \
+    THERMAL_LOG_CAT(THERMAL_LOG_EMIT_, THERMAL_LOG_NARGS(__VA_ARGS__))(level, __VA_ARGS__)
+
+#if THERMAL_LOG_LEVEL >= THERMAL_LOG_LEVEL_ERROR
+#define THERMAL_LOG_ERROR(...) THERMAL_LOG_EMIT(THERMAL_LOG_LEVEL_ERROR, __VA_ARGS__)
+#else
+#define THERMAL_LOG_ERROR(...) ((void)0)
+#endif
+
+#if THERMAL_LOG_LEVEL >= THERMAL_LOG_LEVEL_WARN
+#define THERMAL_LOG_WARN(...) THERMAL_LOG_EMIT(THERMAL_LOG_LEVEL_WARN, __VA_ARGS__)
+#else
+#define THERMAL_LOG_WARN(...) ((void)0)
+#endif
+
+#if THERMAL_LOG_LEVEL >= THERMAL_LOG_LEVEL_INFO
+#define THERMAL_LOG_INFO(...) THERMAL_LOG_EMIT(THERMAL_LOG_LEVEL_INFO, __VA_ARGS__)
+#else
+#define THERMAL_LOG_INFO(...) ((void)0)
+#endif
+
+#if THERMAL_LOG_LEVEL >= THERMAL_LOG_LEVEL_DEBUG
+#define THERMAL_LOG_DEBUG(...) THERMAL_LOG_EMIT(THERMAL_LOG_LEVEL_DEBUG, __VA_ARGS__)
+#else
+#define THERMAL_LOG_DEBUG(...) ((void)0)
+#endif
+
+#endif
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
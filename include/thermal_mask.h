@@ -0,0 +1,44 @@
+#ifndef THERMAL_MASK_H
+#define THERMAL_MASK_H
+
+#include "thermal_types.h"
+
+#define THERMAL_MASK_WORDS_PER_ROW(width) (((size_t)(width) + 63) / 64)
+#define THERMAL_MASK_WORDS(width, height) (THERMAL_MASK_WORDS_PER_ROW(width) * (size_t)(height))
+
+typedef enum {
+    THERMAL_MASK_AND,
+    THERMAL_MASK_OR,
+    THERMAL_MASK_XOR,
+    THERMAL_MASK_AND_NOT
+} thermal_mask_op_t;
+
+/*
+ * One bit per pixel, bit x % 64 of word x / 64 in each row. Rows start on a word boundary and the unused
+ * bits at the end of a row are kept clear, so counts and combines work on whole words.
+ */
+typedef struct {
+    uint64_t *words;
+    thermal_resolution_t resolution;
+    uint16_t words_per_row;
+} thermal_mask_t;
+
+thermal_status_t thermal_mask_init(thermal_mask_t *mask, const thermal_resolution_t *resolution, uint64_t *words, size_t word_count);
+thermal_status_t thermal_mask_threshold(thermal_mask_t *mask, const float *frame, float threshold);
+thermal_status_t thermal_mask_set_rect(thermal_mask_t *mask, const thermal_rect_t *rect, uint8_t value);
+uint8_t thermal_mask_get(const thermal_mask_t *mask, uint16_t x, uint16_t y);
+void thermal_mask_invert(thermal_mask_t *mask);
+thermal_status_t thermal_mask_combine(const thermal_mask_t *a, const thermal_mask_t *b, thermal_mask_op_t op, thermal_mask_t *dst);
+thermal_status_t thermal_mask_erode(const thermal_mask_t *src, thermal_mask_t *dst);
+thermal_status_t thermal_mask_dilate(const thermal_mask_t *src, thermal_mask_t *dst);
+thermal_status_t thermal_mask_open(const thermal_mask_t *src, thermal_mask_t *dst, thermal_mask_t *scratch);
+thermal_status_t thermal_mask_close(const thermal_mask_t *src, thermal_mask_t *dst, thermal_mask_t *scratch);
+size_t thermal_mask_count(const thermal_mask_t *mask);
+size_t thermal_mask_count_and(const thermal_mask_t *a, const thermal_mask_t *b);
+
+#endif
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
@@ -0,0 +1,40 @@
+#ifndef THERMAL_MOSAIC_H
+#define THERMAL_MOSAIC_H
+
+#include "thermal_types.h"
+
+#define THERMAL_MOSAIC_MAX_TILES 8
+
+/* Placement of one sensor in mosaic coordinates; rotation is clockwise and applied before the offset. */
+typedef struct {
+    thermal_resolution_t resolution;
+    int16_t offset_x;
+    int16_t offset_y;
+    thermal_rotation_t rotation;
+} thermal_mosaic_tile_t;
+
+typedef struct {
+    uint32_t src_index;
+    uint8_t tile;
+    float weight;
+} thermal_mosaic_tap_t;
+
+typedef struct {
+    thermal_resolution_t output;
+    thermal_resolution_t tile_res[THERMAL_MOSAIC_MAX_TILES];
+    uint8_t tile_count;
+    uint32_t *offsets;
+    thermal_mosaic_tap_t *taps;
+    float fill_value;
+} thermal_mosaic_t;
+
+thermal_status_t thermal_mosaic_table_size(const thermal_mosaic_tile_t *tiles, uint8_t tile_count, const thermal_resolution_t *output, size_t *offset_count, size_t *tap_count);
+thermal_status_t thermal_mosaic_init(thermal_mosaic_t *mosaic, const thermal_mosaic_tile_t *tiles, uint8_t tile_count, const thermal_resolution_t *output, float fill_value, uint32_t *offsets, size_t offset_count, thermal_mosaic_tap_t *taps, size_t tap_capacity);
+thermal_status_t thermal_mosaic_compose(const thermal_mosaic_t *mosaic, const thermal_frame_t *const *frames, thermal_frame_t *output);
+
+#endif
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
@@ -0,0 +1,61 @@
+#ifndef THERMAL_PIPELINE_H
+#define THERMAL_PIPELINE_H
+
+#include "thermal_core.h"
+#include "platform/platform_hal.h"
+
+#define THERMAL_PIPELINE_MAX_FRAMES 8
+#define THERMAL_PIPELINE_NO_FRAME 0xFF
+
+typedef enum {
+    THERMAL_DROP_OLDEST,
+    THERMAL_DROP_NEWEST
+} thermal_drop_policy_t;
+
+typedef struct {
+    uint32_t acquired;
+    uint32_t delivered;
+    uint32_t dropped_oldest;
+    uint32_t dropped_newest;
+    uint32_t errors;
+} thermal_pipeline_stats_t;
+
+/* Single-index ring of pool slots. The writer owns head, tail is advanced by CAS. */
+typedef struct {
+    _Atomic uint8_t slots[THERMAL_PIPELINE_MAX_FRAMES];
+    platform_atomic_u32_t head;
+    platform_atomic_u32_t tail;
+} thermal_frame_ring_t;
+
+typedef struct {
+    thermal_device_t *device;
+    thermal_frame_t frames[THERMAL_PIPELINE_MAX_FRAMES];
+    uint8_t frame_count;
+    thermal_drop_policy_t policy;
+    uint32_t period_us;
+    uint8_t in_flight;
+    thermal_frame_ring_t ready;
+    thermal_frame_ring_t free;
+    platform_atomic_u32_t running;
+    platform_atomic_u32_t acquired;
+    platform_atomic_u32_t delivered;
+    platform_atomic_u32_t dropped_oldest;
+    platform_atomic_u32_t dropped_newest;
+    platform_atomic_u32_t errors;
+    platform_thread_t thread;
+} thermal_pipeline_t;
+
+thermal_status_t thermal_pipeline_init(thermal_pipeline_t *pipeline, thermal_device_t *device, float *storage, size_t storage_len, thermal_drop_policy_t policy, uint8_t rate_hz);
+thermal_status_t thermal_pipeline_start(thermal_pipeline_t *pipeline);
+/* Call stop from the consumer thread (or with no release in progress): it returns the task's in-flight buffer to the free ring. */
+thermal_status_t thermal_pipeline_stop(thermal_pipeline_t *pipeline);
+thermal_status_t thermal_pipeline_acquire(thermal_pipeline_t *pipeline, thermal_frame_t **frame, uint32_t timeout_us);
+thermal_status_t thermal_pipeline_release(thermal_pipeline_t *pipeline, thermal_frame_t *frame);
+thermal_status_t thermal_pipeline_get_stats(thermal_pipeline_t *pipeline, thermal_pipeline_stats_t *stats);
+
+#endif
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
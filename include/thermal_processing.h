@@ -2,6 +2,7 @@
 #define THERMAL_PROCESSING_H
 
 #include "thermal_types.h"
+#include "thermal_arena.h"
 
 typedef struct {
     float min_temp;
@@ -21,8 +22,19 @@ typedef struct {
 thermal_status_t thermal_find_minmax(const float *frame, const thermal_resolution_t *resolution, thermal_minmax_t *result);
 thermal_status_t thermal_find_hotspots(const float *frame, const thermal_resolution_t *resolution, float threshold, thermal_hotspot_t *hotspots, size_t max_spots, size_t *found);
 thermal_status_t thermal_interpolate_bilinear(const float *src, const thermal_resolution_t *src_res, float *dst, const thermal_resolution_t *dst_res);
-thermal_status_t thermal_median_filter(const float *src, const thermal_resolution_t *resolution, float *dst, uint8_t kernel_size);
+thermal_status_t thermal_interpolate_bilinear_region(const float *src, const thermal_resolution_t *src_res, float *dst, const thermal_resolution_t *dst_res, const thermal_rect_t *region);
+thermal_status_t thermal_median_filter(const float *src, const thermal_resolution_t *resolution, float *dst, uint8_t kernel_size, thermal_arena_t *scratch);
+size_t thermal_median_filter_scratch_size(uint8_t kernel_size);
 thermal_status_t thermal_apply_colormap(const float *frame, const thermal_resolution_t *resolution, float min_temp, float max_temp, rgb565_t *output);
+thermal_status_t thermal_apply_colormap_region(const float *frame, const thermal_resolution_t *resolution, float min_temp, float max_temp, rgb565_t *output, const thermal_rect_t *region);
+
+/* The palette every colormap kernel implements, for callers that build their own lookup tables. */
+void thermal_colormap_rgb(float temp, float min_temp, float max_temp, uint8_t *r, uint8_t *g, uint8_t *b);
+
+/* Batch variants: count frames of one resolution stored back to back, with per-frame results in the same order. */
+thermal_status_t thermal_find_minmax_batch(const float *frames, const thermal_resolution_t *resolution, size_t count, thermal_minmax_t *results);
+thermal_status_t thermal_find_hotspots_batch(const float *frames, const thermal_resolution_t *resolution, size_t count, float threshold, thermal_hotspot_t *hotspots, size_t max_spots, size_t *found);
+thermal_status_t thermal_apply_colormap_batch(const float *frames, const thermal_resolution_t *resolution, size_t count, float min_temp, float max_temp, const thermal_minmax_t *ranges, rgb565_t *output);
 
 #endif
 
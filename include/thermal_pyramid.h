@@ -0,0 +1,41 @@
+#ifndef THERMAL_PYRAMID_H
+#define THERMAL_PYRAMID_H
+
+#include "thermal_processing.h"
+
+#define THERMAL_PYRAMID_MAX_LEVELS 8
+
+typedef enum {
+    THERMAL_REDUCE_MEAN,
+    THERMAL_REDUCE_MAX,
+    THERMAL_REDUCE_MIN
+} thermal_reduce_t;
+
+/* Each level halves the previous one (rounding up), so an odd edge cell covers a single row or column. */
+typedef struct {
+    float *data;
+    thermal_resolution_t resolution;
+    thermal_reduce_t reduce;
+} thermal_pyramid_level_t;
+
+/* levels[0] is reduced from the frame itself, levels[n] from levels[n - 1]; all share one caller buffer. */
+typedef struct {
+    thermal_resolution_t base;
+    const float *frame;
+    thermal_pyramid_level_t levels[THERMAL_PYRAMID_MAX_LEVELS];
+    uint8_t level_count;
+    uint8_t max_levels;
+} thermal_pyramid_t;
+
+size_t thermal_pyramid_buffer_size(const thermal_resolution_t *base, uint8_t level_count);
+thermal_status_t thermal_pyramid_init(thermal_pyramid_t *pyramid, const thermal_resolution_t *base, const thermal_reduce_t *reduce, uint8_t level_count, float *buffer, size_t buffer_len);
+thermal_status_t thermal_pyramid_build(thermal_pyramid_t *pyramid, const thermal_frame_t *frame);
+thermal_status_t thermal_pyramid_find_hotspots(const thermal_pyramid_t *pyramid, float threshold, thermal_hotspot_t *hotspots, size_t max_spots, size_t *found);
+thermal_status_t thermal_pyramid_count_above(const thermal_pyramid_t *pyramid, float threshold, size_t *count);
+
+#endif
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
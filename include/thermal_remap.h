@@ -0,0 +1,50 @@
+#ifndef THERMAL_REMAP_H
+#define THERMAL_REMAP_H
+
+#include "thermal_types.h"
+
+#define THERMAL_REMAP_BLOCK_SIZE 8
+#define THERMAL_REMAP_NO_SOURCE 0xFFFFFFFFu
+
+/*
+ * Correction from sensor to output: radial undistortion, then flips, then a clockwise rotation, then the
+ * homography. k1/k2 are Brown radial coefficients on coordinates normalised so a sensor corner sits at radius 1.
+ * homography is row-major and maps output pixels to oriented pixels; NULL means none.
+ */
+typedef struct {
+    uint8_t flip_horizontal;
+    uint8_t flip_vertical;
+    thermal_rotation_t rotation;
+    float k1;
+    float k2;
+    const float *homography;
+} thermal_remap_config_t;
+
+/* index is the top-left bilinear tap in the source frame; fx/fy weight the right and lower taps. */
+typedef struct {
+    uint32_t index;
+    float fx;
+    float fy;
+} thermal_remap_tap_t;
+
+/* With no distortion or homography taps is NULL and the remap is a flip/transpose of the source. */
+typedef struct {
+    thermal_resolution_t src_res;
+    thermal_resolution_t dst_res;
+    uint8_t transpose;
+    uint8_t reverse_x;
+    uint8_t reverse_y;
+    thermal_remap_tap_t *taps;
+    float fill_value;
+} thermal_remap_t;
+
+thermal_status_t thermal_remap_table_size(const thermal_remap_config_t *config, const thermal_resolution_t *src_res, size_t *tap_count);
+thermal_status_t thermal_remap_init(thermal_remap_t *remap, const thermal_remap_config_t *config, const thermal_resolution_t *src_res, float fill_value, thermal_remap_tap_t *taps, size_t tap_capacity);
+thermal_status_t thermal_remap_apply(const thermal_remap_t *remap, const thermal_frame_t *src, thermal_frame_t *dst);
+
+#endif
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
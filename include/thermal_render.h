@@ -0,0 +1,45 @@
+#ifndef THERMAL_RENDER_H
+#define THERMAL_RENDER_H
+
+#include "thermal_types.h"
+
+#define THERMAL_PALETTE_SIZE 256
+
+/* RGB565 in either byte order, RGB888 as R,G,B bytes, ARGB8888 as a native-endian 0xAARRGGBB word. */
+typedef enum {
+    THERMAL_PIXEL_RGB565_LE,
+    THERMAL_PIXEL_RGB565_BE,
+    THERMAL_PIXEL_RGB888,
+    THERMAL_PIXEL_ARGB8888
+} thermal_pixel_format_t;
+
+typedef enum {
+    THERMAL_SCALE_NEAREST,
+    THERMAL_SCALE_BILINEAR
+} thermal_scale_t;
+
+/* Colormap pre-encoded in the framebuffer's pixel format, so rendering is one table copy per pixel. */
+typedef struct {
+    thermal_pixel_format_t format;
+    uint8_t bytes_per_pixel;
+    uint8_t colors[THERMAL_PALETTE_SIZE][4];
+} thermal_palette_t;
+
+/* stride is in bytes and may exceed width * bytes_per_pixel for padded or partial-screen buffers. */
+typedef struct {
+    void *pixels;
+    size_t stride;
+    uint16_t width;
+    uint16_t height;
+    thermal_pixel_format_t format;
+} thermal_framebuffer_t;
+
+thermal_status_t thermal_palette_init(thermal_palette_t *palette, thermal_pixel_format_t format);
+thermal_status_t thermal_render(const thermal_frame_t *frame, const thermal_palette_t *palette, float min_temp, float max_temp, thermal_scale_t scale, const thermal_framebuffer_t *framebuffer, const thermal_rect_t *dest);
+
+#endif
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
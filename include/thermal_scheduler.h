@@ -0,0 +1,66 @@
+#ifndef THERMAL_SCHEDULER_H
+#define THERMAL_SCHEDULER_H
+
+#include "thermal_core.h"
+#include "platform/platform_hal.h"
+
+#define THERMAL_SCHED_MAX_DEVICES 16
+#define THERMAL_SCHED_MAX_BUSES 4
+#define THERMAL_SCHED_MAX_SLEEP_US 10000
+
+typedef void (*thermal_sched_frame_fn)(thermal_device_t *device, const thermal_frame_t *frame, void *ctx);
+
+typedef struct {
+    uint32_t frames;
+    uint32_t skipped;
+    uint32_t errors;
+    uint32_t last_lateness_us;
+    uint32_t max_lateness_us;
+    uint64_t total_lateness_us;
+} thermal_sched_stats_t;
+
+typedef struct {
+    thermal_device_t *device;
+    thermal_frame_t frame;
+    thermal_sched_frame_fn on_frame;
+    void *ctx;
+    uint32_t period_us;
+    uint64_t release_us;
+    uint8_t bus;
+    /* Odd while the bus thread updates stats, so thermal_scheduler_get_stats() can retry a torn copy. */
+    platform_atomic_u32_t stats_sequence;
+    thermal_sched_stats_t stats;
+} thermal_sched_entry_t;
+
+typedef struct thermal_scheduler thermal_scheduler_t;
+
+typedef struct {
+    thermal_scheduler_t *owner;
+    void *hw_handle;
+    uint8_t index;
+    uint8_t members[THERMAL_SCHED_MAX_DEVICES];
+    uint8_t member_count;
+    platform_thread_t thread;
+} thermal_sched_bus_t;
+
+struct thermal_scheduler {
+    thermal_sched_entry_t entries[THERMAL_SCHED_MAX_DEVICES];
+    uint8_t entry_count;
+    thermal_sched_bus_t buses[THERMAL_SCHED_MAX_BUSES];
+    uint8_t bus_count;
+    platform_atomic_u32_t running;
+};
+
+thermal_status_t thermal_scheduler_init(thermal_scheduler_t *sched);
+thermal_status_t thermal_scheduler_add(thermal_scheduler_t *sched, thermal_device_t *device, float *buffer, size_t buf_len, thermal_sched_frame_fn on_frame, void *ctx, uint8_t *entry_index);
+thermal_status_t thermal_scheduler_poll(thermal_scheduler_t *sched, uint8_t bus);
+thermal_status_t thermal_scheduler_start(thermal_scheduler_t *sched);
+thermal_status_t thermal_scheduler_stop(thermal_scheduler_t *sched);
+thermal_status_t thermal_scheduler_get_stats(thermal_scheduler_t *sched, uint8_t entry_index, thermal_sched_stats_t *stats);
+
+#endif
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
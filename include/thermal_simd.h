@@ -0,0 +1,57 @@
+#ifndef THERMAL_SIMD_H
+#define THERMAL_SIMD_H
+
+#include "thermal_types.h"
+
+typedef enum {
+    THERMAL_SIMD_SCALAR,
+    THERMAL_SIMD_SSE41,
+    THERMAL_SIMD_AVX2,
+    THERMAL_SIMD_NEON,
+    THERMAL_SIMD_LEVEL_COUNT
+} thermal_simd_level_t;
+
+/*
+ * Hot loops shared by the processing functions and sensor decode. Row kernels
+ * write out[x] for x in [x_start, x_end); median3_row expects x_start >= 1 and
+ * x_end < width so every 3x3 neighbour exists. threshold_bits sets bit i % 64 of
+ * bits[i / 64] when src[i] >= threshold (never for NaN) and clears unused bits
+ * of the last word. minmax_batch runs minmax on count frames of pixels floats
+ * stored back to back, one frame per vector lane.
+ */
+typedef struct {
+    thermal_simd_level_t level;
+    const char *name;
+    void (*minmax)(const float *data, size_t count, float *min_value, size_t *min_index, float *max_value, size_t *max_index);
+    void (*colormap)(const float *src, size_t count, float min_temp, float max_temp, rgb565_t *dst);
+    void (*bilinear_row)(const float *row1, const float *row2, uint16_t src_width, float x_ratio, float dy, uint16_t x_start, uint16_t x_end, float *out);
+    void (*median3_row)(const float *up, const float *row, const float *down, uint16_t x_start, uint16_t x_end, float *out);
+    void (*ir_decode)(const uint16_t *raw, const uint16_t *alpha, const int16_t *offset, const float *kta, const float *kv, float ta, float vdd, size_t count, float *out);
+    void (*threshold_bits)(const float *src, size_t count, float threshold, uint64_t *bits);
+    void (*minmax_batch)(const float *frames, size_t pixels, size_t count, float *min_values, size_t *min_indices, float *max_values, size_t *max_indices);
+} thermal_simd_ops_t;
+
+thermal_simd_level_t thermal_simd_init(void);
+const thermal_simd_ops_t *thermal_simd_ops(void);
+uint8_t thermal_simd_supported(thermal_simd_level_t level);
+thermal_status_t thermal_simd_select(thermal_simd_level_t level);
+thermal_status_t thermal_simd_self_check(thermal_simd_level_t level);
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define THERMAL_SIMD_X86 1
+extern const thermal_simd_ops_t thermal_simd_sse41_ops;
+extern const thermal_simd_ops_t thermal_simd_avx2_ops;
+#endif
+
+/* The NEON kernels have not yet been built and self-checked on AArch64 hardware, so they are opt-in. */
+#if defined(__aarch64__) && defined(THERMAL_SIMD_ENABLE_NEON)
+#define THERMAL_SIMD_ARM_NEON 1
+extern const thermal_simd_ops_t thermal_simd_neon_ops;
+#endif
+
+#endif
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
@@ -0,0 +1,55 @@
+#ifndef THERMAL_SNAPSHOT_H
+#define THERMAL_SNAPSHOT_H
+
+#include "thermal_types.h"
+#include "platform/platform_hal.h"
+
+#define THERMAL_SNAPSHOT_BUFFERS 2
+#define THERMAL_SNAPSHOT_RETRIES 8
+
+/*
+ * Single-writer, multi-reader "latest frame". The writer fills the buffer readers are not looking at, and each
+ * buffer carries a sequence lock: 2 * id while it holds frame id, odd while it is being rewritten. Readers never
+ * block the writer; a read that overlapped a rewrite is detected and retried.
+ */
+typedef struct {
+    thermal_frame_t frames[THERMAL_SNAPSHOT_BUFFERS];
+    platform_atomic_u32_t sequence[THERMAL_SNAPSHOT_BUFFERS];
+    platform_atomic_u32_t latest;
+    platform_atomic_u32_t retries;
+    uint32_t next_id;
+    uint8_t back;
+} thermal_snapshot_t;
+
+/* Per-reader bookkeeping; after a read, frames first_missed .. first_missed + missed - 1 were never seen. */
+typedef struct {
+    uint32_t last_id;
+    uint32_t first_missed;
+    uint32_t missed;
+    uint32_t total_missed;
+} thermal_snapshot_reader_t;
+
+/* A zero-copy view is only trustworthy once thermal_snapshot_view_end() has accepted it. */
+typedef struct {
+    thermal_frame_t frame;
+    uint32_t id;
+    uint32_t sequence;
+    uint8_t buffer;
+} thermal_snapshot_view_t;
+
+thermal_status_t thermal_snapshot_init(thermal_snapshot_t *snapshot, const thermal_resolution_t *resolution, float *storage, size_t storage_len);
+thermal_frame_t *thermal_snapshot_write_begin(thermal_snapshot_t *snapshot);
+thermal_status_t thermal_snapshot_write_end(thermal_snapshot_t *snapshot);
+thermal_status_t thermal_snapshot_publish(thermal_snapshot_t *snapshot, const thermal_frame_t *frame);
+thermal_status_t thermal_snapshot_view_begin(thermal_snapshot_t *snapshot, thermal_snapshot_view_t *view);
+thermal_status_t thermal_snapshot_view_end(thermal_snapshot_t *snapshot, const thermal_snapshot_view_t *view, thermal_snapshot_reader_t *reader);
+thermal_status_t thermal_snapshot_read(thermal_snapshot_t *snapshot, thermal_frame_t *dst, thermal_snapshot_reader_t *reader);
+uint32_t thermal_snapshot_latest_id(thermal_snapshot_t *snapshot);
+void thermal_snapshot_reader_init(thermal_snapshot_reader_t *reader);
+
+#endif
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
@@ -0,0 +1,68 @@
+#ifndef THERMAL_TRACE_H
+#define THERMAL_TRACE_H
+
+#include "thermal_types.h"
+#include "thermal_arena.h"
+
+/* Trace points compile to nothing unless THERMAL_TRACE_ENABLED is non-zero. */
+#ifndef THERMAL_TRACE_ENABLED
+#define THERMAL_TRACE_ENABLED 0
+#endif
+
+#define THERMAL_TRACE_RING_SIZE 512
+/* Arena bytes thermal_trace_summary() needs to sort one stage's durations. */
+#define THERMAL_TRACE_SCRATCH_SIZE THERMAL_ARENA_SIZE(THERMAL_TRACE_RING_SIZE * sizeof(uint32_t))
+
+typedef enum {
+    THERMAL_STAGE_FRAME,
+    THERMAL_STAGE_BUS,
+    THERMAL_STAGE_DECODE,
+    THERMAL_STAGE_FILTER,
+    THERMAL_STAGE_INTERPOLATE,
+    THERMAL_STAGE_COLORMAP,
+    THERMAL_STAGE_APP,
+    THERMAL_STAGE_COUNT
+} thermal_trace_stage_t;
+
+typedef struct {
+    uint64_t begin_us;
+    uint32_t duration_us;
+    uint32_t frame_id;
+    uint8_t stage;
+} thermal_trace_event_t;
+
+typedef struct {
+    uint32_t count;
+    uint32_t p50_us;
+    uint32_t p99_us;
+    uint32_t max_us;
+    uint32_t overruns;
+} thermal_trace_summary_t;
+
+typedef void (*thermal_trace_write_fn)(const char *chunk, size_t len, void *ctx);
+
+uint64_t thermal_trace_now(void);
+void thermal_trace_set_frame(uint32_t frame_id);
+uint32_t thermal_trace_current_frame(void);
+void thermal_trace_record(uint8_t stage, uint32_t frame_id, uint64_t begin_us);
+void thermal_trace_reset(void);
+thermal_status_t thermal_trace_set_deadline(thermal_trace_stage_t stage, uint32_t deadline_us);
+thermal_status_t thermal_trace_summary(thermal_trace_stage_t stage, thermal_trace_summary_t *summary, thermal_arena_t *scratch);
+thermal_status_t thermal_trace_export_chrome(thermal_trace_write_fn write, void *ctx);
+
+#if THERMAL_TRACE_ENABLED
+#define THERMAL_TRACE_FRAME(frame_id) thermal_trace_set_frame(frame_id)
+#define THERMAL_TRACE_BEGIN(stage) uint64_t thermal_trace_begin_##stage = thermal_trace_now()
+#define THERMAL_TRACE_END(stage) thermal_trace_record((stage), thermal_trace_current_frame(), thermal_trace_begin_##stage)
+#else
+#define THERMAL_TRACE_FRAME(frame_id) ((void)0)
+#define THERMAL_TRACE_BEGIN(stage) ((void)0)
+#define THERMAL_TRACE_END(stage) ((void)0)
+#endif
+
+#endif
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
@@ -0,0 +1,88 @@
+#ifndef THERMAL_TRACKER_H
+#define THERMAL_TRACKER_H
+
+#include "thermal_processing.h"
+
+#define THERMAL_TRACKER_MAX_TRACKS 16
+#define THERMAL_TRACKER_MAX_DETECTIONS 16
+#define THERMAL_TRACKER_MAX_LINES 4
+
+typedef enum {
+    THERMAL_TRACK_EVENT_START,
+    THERMAL_TRACK_EVENT_END,
+    THERMAL_TRACK_EVENT_CROSS
+} thermal_track_event_type_t;
+
+typedef struct {
+    float x;
+    float y;
+    float temperature;
+} thermal_detection_t;
+
+/* gate_distance is in pixels; alpha/beta are the position and velocity gains of the constant-velocity filter. */
+typedef struct {
+    float gate_distance;
+    float alpha;
+    float beta;
+    uint8_t confirm_hits;
+    uint8_t max_misses;
+} thermal_tracker_config_t;
+
+typedef struct {
+    uint16_t id;
+    uint8_t confirmed;
+    uint8_t misses;
+    uint16_t hits;
+    float x;
+    float y;
+    float vx;
+    float vy;
+    float last_x;
+    float last_y;
+    float temperature;
+} thermal_track_t;
+
+/* positive counts moves onto the side where (x1 - x0) * (y - y0) - (y1 - y0) * (x - x0) >= 0, negative the reverse. */
+typedef struct {
+    float x0;
+    float y0;
+    float x1;
+    float y1;
+    uint32_t positive;
+    uint32_t negative;
+} thermal_tracker_line_t;
+
+typedef struct {
+    thermal_track_event_type_t type;
+    uint16_t track_id;
+    uint8_t line;
+    int8_t direction;
+    float x;
+    float y;
+} thermal_track_event_t;
+
+typedef struct {
+    thermal_tracker_config_t config;
+    thermal_track_t tracks[THERMAL_TRACKER_MAX_TRACKS];
+    uint8_t track_count;
+    thermal_tracker_line_t lines[THERMAL_TRACKER_MAX_LINES];
+    uint8_t line_count;
+    uint16_t next_id;
+    float cost[THERMAL_TRACKER_MAX_TRACKS][THERMAL_TRACKER_MAX_DETECTIONS];
+    uint32_t dropped_detections;
+    uint32_t dropped_events;
+} thermal_tracker_t;
+
+thermal_status_t thermal_tracker_init(thermal_tracker_t *tracker, const thermal_tracker_config_t *config);
+thermal_status_t thermal_tracker_add_line(thermal_tracker_t *tracker, float x0, float y0, float x1, float y1, uint8_t *line_index);
+thermal_status_t thermal_tracker_update(thermal_tracker_t *tracker, const thermal_detection_t *detections, size_t count, thermal_track_event_t *events, size_t max_events, size_t *event_count);
+thermal_status_t thermal_tracker_update_hotspots(thermal_tracker_t *tracker, const thermal_hotspot_t *hotspots, size_t count, thermal_track_event_t *events, size_t max_events, size_t *event_count);
+uint8_t thermal_tracker_occupancy(const thermal_tracker_t *tracker);
+void thermal_tracker_reset(thermal_tracker_t *tracker);
+
+#endif
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
@@ -14,6 +14,8 @@ typedef thermal_status_t (*transport_read_burst_fn)(void *hw_handle, uint8_t dev
 struct thermal_transport {
     thermal_transport_type_t type;
     void *hw_handle;
+    /* The physical bus; wrappers such as the timed transport keep the wrapped transport's bus. */
+    void *bus;
     transport_init_fn init;
     transport_deinit_fn deinit;
     transport_read_reg_fn read_reg;
@@ -21,8 +23,50 @@ struct thermal_transport {
     transport_read_burst_fn read_burst;
 };
 
+/*
+ * Wire-time model shared by every device on one bus. freq_hz is the clock from the bus config
+ * (esp32_i2c_config_t, esp32_spi_config_t); stretch_ns is clock stretching charged per byte,
+ * turnaround_ns the idle gap after each transaction (I2C bus-free time, SPI chip-select setup).
+ */
+typedef struct {
+    uint32_t freq_hz;
+    uint32_t stretch_ns;
+    uint32_t turnaround_ns;
+    uint8_t real_time;
+} thermal_bus_timing_t;
+
+/* One per physical bus: the clock and statistics that every timed transport on the bus charges. */
+typedef struct {
+    thermal_bus_timing_t timing;
+    uint64_t clock_ns;
+    uint64_t busy_ns;
+    uint64_t start_us;
+    uint32_t transactions;
+    uint32_t bytes;
+} thermal_bus_emulator_t;
+
+/* One per device: the wrapped transport and its register address width (2 for the MLX90640, 1 for the AMG8833). */
+typedef struct {
+    thermal_bus_emulator_t *bus;
+    thermal_transport_t inner;
+    uint8_t reg_addr_bytes;
+} thermal_timed_transport_t;
+
+typedef struct {
+    uint64_t busy_us;
+    uint64_t elapsed_us;
+    uint32_t transactions;
+    uint32_t bytes;
+    float utilization;
+} thermal_bus_stats_t;
+
 thermal_status_t i2c_transport_create(thermal_transport_t *transport, void *hw_handle);
 thermal_status_t spi_transport_create(thermal_transport_t *transport, void *hw_handle);
+thermal_status_t timed_bus_init(thermal_bus_emulator_t *emulator, const thermal_bus_timing_t *timing);
+thermal_status_t timed_transport_create(thermal_transport_t *transport, thermal_timed_transport_t *timed, thermal_bus_emulator_t *emulator, const thermal_transport_t *inner, uint8_t reg_addr_bytes);
+void timed_transport_idle(thermal_bus_emulator_t *emulator, uint32_t us);
+void timed_transport_get_stats(const thermal_bus_emulator_t *emulator, thermal_bus_stats_t *stats);
+void timed_transport_reset_stats(thermal_bus_emulator_t *emulator);
 
 #endif
 
@@ -28,10 +28,25 @@ typedef struct {
     uint16_t height;
 } thermal_resolution_t;
 
+typedef struct {
+    uint16_t x;
+    uint16_t y;
+    uint16_t width;
+    uint16_t height;
+} thermal_rect_t;
+
+typedef enum {
+    THERMAL_ROTATE_0,
+    THERMAL_ROTATE_90,
+    THERMAL_ROTATE_180,
+    THERMAL_ROTATE_270
+} thermal_rotation_t;
+
 typedef struct {
     float *data;
     thermal_resolution_t resolution;
     uint32_t timestamp;
+    uint8_t unchanged;
 } thermal_frame_t;
 
 typedef struct {
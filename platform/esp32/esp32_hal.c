@@ -201,6 +201,79 @@ int esp32_spi_read_burst(void *handle, uint8_t dev_addr, uint16_t start_reg, uin
     return 0;
 }
 
+static uint64_t virtual_time_us = 0;
+
+uint64_t esp32_time_us(void) {
+    return virtual_time_us;
+}
+
+void esp32_sleep_us(uint32_t us) {
+    virtual_time_us += us;
+}
+
+void esp32_sleep_until_us(uint64_t deadline_us) {
+    if (deadline_us > virtual_time_us) {
+        virtual_time_us = deadline_us;
+    }
+}
+
+int esp32_thread_create(esp32_thread_t *thread, void (*entry)(void *arg), void *arg) {
+    if (!thread || !entry) {
+        return -1;
+    }
+    
+    thread->entry = entry;
+    thread->arg = arg;
+    thread->created = 0;
+    
+    printf("ESP32: task creation not available in stub HAL\n");
+    return -1;
+}
+
+int esp32_thread_join(esp32_thread_t *thread) {
+    if (!thread || !thread->created) {
+        return -1;
+    }
+    
+    thread->created = 0;
+    return 0;
+}
+
+int esp32_mutex_init(esp32_mutex_t *mutex) {
+    if (!mutex) {
+        return -1;
+    }
+    
+    mutex->locked = 0;
+    return 0;
+}
+
+int esp32_mutex_lock(esp32_mutex_t *mutex) {
+    if (!mutex || mutex->locked) {
+        return -1;
+    }
+    
+    mutex->locked = 1;
+    return 0;
+}
+
+int esp32_mutex_unlock(esp32_mutex_t *mutex) {
+    if (!mutex || !mutex->locked) {
+        return -1;
+    }
+    
+    mutex->locked = 0;
+    return 0;
+}
+
+void esp32_mutex_destroy(esp32_mutex_t *mutex) {
+    if (!mutex) {
+        return;
+    }
+    
+    mutex->locked = 0;
+}
+
 /*
 Developed by Brandon | Github; A31A18B25C9D012
 For public use and modification, see LICENSE file in the root of this repository.
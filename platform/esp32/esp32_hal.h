@@ -20,6 +20,16 @@ typedef struct {
     uint8_t host;
 } esp32_spi_config_t;
 
+typedef struct {
+    void (*entry)(void *arg);
+    void *arg;
+    uint8_t created;
+} esp32_thread_t;
+
+typedef struct {
+    volatile uint8_t locked;
+} esp32_mutex_t;
+
 void *esp32_i2c_init(const esp32_i2c_config_t *config);
 void esp32_i2c_deinit(void *handle);
 int esp32_i2c_read(void *handle, uint8_t dev_addr, uint16_t reg, uint8_t *data, size_t len);
@@ -32,6 +42,18 @@ int esp32_spi_read(void *handle, uint8_t dev_addr, uint16_t reg, uint8_t *data,
 int esp32_spi_write(void *handle, uint8_t dev_addr, uint16_t reg, const uint8_t *data, size_t len);
 int esp32_spi_read_burst(void *handle, uint8_t dev_addr, uint16_t start_reg, uint8_t *buffer, size_t len);
 
+uint64_t esp32_time_us(void);
+void esp32_sleep_us(uint32_t us);
+void esp32_sleep_until_us(uint64_t deadline_us);
+
+int esp32_thread_create(esp32_thread_t *thread, void (*entry)(void *arg), void *arg);
+int esp32_thread_join(esp32_thread_t *thread);
+
+int esp32_mutex_init(esp32_mutex_t *mutex);
+int esp32_mutex_lock(esp32_mutex_t *mutex);
+int esp32_mutex_unlock(esp32_mutex_t *mutex);
+void esp32_mutex_destroy(esp32_mutex_t *mutex);
+
 #endif
 
 /*
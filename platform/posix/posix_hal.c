@@ -0,0 +1,418 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "posix_hal.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+
+#ifdef __linux__
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+#include <linux/spi/spidev.h>
+#endif
+
+#define POSIX_SIM_REG_SPACE 0x10000
+#define POSIX_MAX_WRITE_LEN 256
+#define POSIX_SPI_READ_FLAG 0x80
+
+typedef struct {
+    int fd;
+    uint8_t *sim_regs;
+    uint32_t freq_hz;
+    uint8_t mode;
+    uint8_t reg_addr_bytes;
+    pthread_mutex_t lock;
+} posix_bus_handle_t;
+
+static posix_bus_handle_t *bus_open(const char *device, uint32_t freq_hz, uint8_t mode, uint8_t reg_addr_bytes, const char *tag) {
+    posix_bus_handle_t *handle = (posix_bus_handle_t *)malloc(sizeof(posix_bus_handle_t));
+    if (!handle) {
+        printf("POSIX %s: allocation failed\n", tag);
+        return NULL;
+    }
+
+    handle->fd = -1;
+    handle->sim_regs = NULL;
+    handle->freq_hz = freq_hz;
+    handle->mode = mode;
+    handle->reg_addr_bytes = reg_addr_bytes;
+
+    if (!device) {
+        handle->sim_regs = (uint8_t *)calloc(POSIX_SIM_REG_SPACE, 1);
+        if (!handle->sim_regs) {
+            printf("POSIX %s: simulated register space allocation failed\n", tag);
+            free(handle);
+            return NULL;
+        }
+    } else {
+        handle->fd = open(device, O_RDWR);
+        if (handle->fd < 0) {
+            printf("POSIX %s: cannot open %s (%s)\n", tag, device, strerror(errno));
+            free(handle);
+            return NULL;
+        }
+    }
+
+    pthread_mutex_init(&handle->lock, NULL);
+    return handle;
+}
+
+static void bus_close(posix_bus_handle_t *handle) {
+    if (handle->fd >= 0) {
+        close(handle->fd);
+    }
+    free(handle->sim_regs);
+    pthread_mutex_destroy(&handle->lock);
+    free(handle);
+}
+
+static size_t encode_reg_addr(const posix_bus_handle_t *handle, uint16_t reg, uint8_t *out) {
+    uint8_t bytes = handle->reg_addr_bytes;
+    if (bytes == 0) {
+        bytes = (reg > 0xFF) ? 2 : 1;
+    }
+
+    if (bytes == 1) {
+        out[0] = (uint8_t)(reg & 0xFF);
+        return 1;
+    }
+
+    out[0] = (uint8_t)(reg >> 8);
+    out[1] = (uint8_t)(reg & 0xFF);
+    return 2;
+}
+
+static void sim_read(posix_bus_handle_t *handle, uint16_t reg, uint8_t *data, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        data[i] = handle->sim_regs[(reg + i) & (POSIX_SIM_REG_SPACE - 1)];
+    }
+}
+
+static void sim_write(posix_bus_handle_t *handle, uint16_t reg, const uint8_t *data, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        handle->sim_regs[(reg + i) & (POSIX_SIM_REG_SPACE - 1)] = data[i];
+    }
+}
+
+static int i2c_dev_read(posix_bus_handle_t *handle, uint8_t dev_addr, uint16_t reg, uint8_t *data, size_t len) {
+#ifdef __linux__
+    uint8_t addr_buf[2];
+    size_t addr_len = encode_reg_addr(handle, reg, addr_buf);
+
+    struct i2c_msg msgs[2] = {
+        { .addr = dev_addr, .flags = 0, .len = (uint16_t)addr_len, .buf = addr_buf },
+        { .addr = dev_addr, .flags = I2C_M_RD, .len = (uint16_t)len, .buf = data }
+    };
+    struct i2c_rdwr_ioctl_data xfer = { .msgs = msgs, .nmsgs = 2 };
+
+    return ioctl(handle->fd, I2C_RDWR, &xfer) < 0 ? -1 : 0;
+#else
+    (void)handle; (void)dev_addr; (void)reg; (void)data; (void)len;
+    return -1;
+#endif
+}
+
+static int i2c_dev_write(posix_bus_handle_t *handle, uint8_t dev_addr, uint16_t reg, const uint8_t *data, size_t len) {
+#ifdef __linux__
+    uint8_t buf[2 + POSIX_MAX_WRITE_LEN];
+    size_t addr_len = encode_reg_addr(handle, reg, buf);
+    memcpy(buf + addr_len, data, len);
+
+    struct i2c_msg msg = { .addr = dev_addr, .flags = 0, .len = (uint16_t)(addr_len + len), .buf = buf };
+    struct i2c_rdwr_ioctl_data xfer = { .msgs = &msg, .nmsgs = 1 };
+
+    return ioctl(handle->fd, I2C_RDWR, &xfer) < 0 ? -1 : 0;
+#else
+    (void)handle; (void)dev_addr; (void)reg; (void)data; (void)len;
+    return -1;
+#endif
+}
+
+static int spi_dev_transfer(posix_bus_handle_t *handle, uint16_t reg, uint8_t read_flag, const uint8_t *tx, uint8_t *rx, size_t len) {
+#ifdef __linux__
+    uint8_t addr_buf[2];
+    size_t addr_len = encode_reg_addr(handle, reg, addr_buf);
+    addr_buf[0] |= read_flag;
+
+    struct spi_ioc_transfer xfer[2];
+    memset(xfer, 0, sizeof(xfer));
+    xfer[0].tx_buf = (unsigned long)addr_buf;
+    xfer[0].len = (uint32_t)addr_len;
+    xfer[0].speed_hz = handle->freq_hz;
+    xfer[1].tx_buf = (unsigned long)tx;
+    xfer[1].rx_buf = (unsigned long)rx;
+    xfer[1].len = (uint32_t)len;
+    xfer[1].speed_hz = handle->freq_hz;
+
+    return ioctl(handle->fd, SPI_IOC_MESSAGE(2), xfer) < 0 ? -1 : 0;
+#else
+    (void)handle; (void)reg; (void)read_flag; (void)tx; (void)rx; (void)len;
+    return -1;
+#endif
+}
+
+void *posix_i2c_init(const posix_i2c_config_t *config) {
+    if (!config) {
+        printf("POSIX I2C: invalid config\n");
+        return NULL;
+    }
+
+    posix_bus_handle_t *handle = bus_open(config->device, config->freq_hz, 0, config->reg_addr_bytes, "I2C");
+    if (!handle) {
+        return NULL;
+    }
+
+    printf("POSIX I2C: initialized on %s (freq=%u Hz)\n",
+           config->device ? config->device : "simulated bus", config->freq_hz);
+
+    return handle;
+}
+
+void posix_i2c_deinit(void *handle) {
+    if (!handle) {
+        return;
+    }
+
+    printf("POSIX I2C: deinitialized\n");
+    bus_close((posix_bus_handle_t *)handle);
+}
+
+int posix_i2c_read(void *handle, uint8_t dev_addr, uint16_t reg, uint8_t *data, size_t len) {
+    if (!handle || !data || len == 0 || len > UINT16_MAX) {
+        return -1;
+    }
+
+    posix_bus_handle_t *bus = (posix_bus_handle_t *)handle;
+    int result = 0;
+
+    pthread_mutex_lock(&bus->lock);
+    if (bus->sim_regs) {
+        sim_read(bus, reg, data, len);
+    } else {
+        result = i2c_dev_read(bus, dev_addr, reg, data, len);
+    }
+    pthread_mutex_unlock(&bus->lock);
+
+    return result;
+}
+
+int posix_i2c_write(void *handle, uint8_t dev_addr, uint16_t reg, const uint8_t *data, size_t len) {
+    if (!handle || !data || len == 0 || len > POSIX_MAX_WRITE_LEN) {
+        return -1;
+    }
+
+    posix_bus_handle_t *bus = (posix_bus_handle_t *)handle;
+    int result = 0;
+
+    pthread_mutex_lock(&bus->lock);
+    if (bus->sim_regs) {
+        sim_write(bus, reg, data, len);
+    } else {
+        result = i2c_dev_write(bus, dev_addr, reg, data, len);
+    }
+    pthread_mutex_unlock(&bus->lock);
+
+    return result;
+}
+
+int posix_i2c_read_burst(void *handle, uint8_t dev_addr, uint16_t start_reg, uint8_t *buffer, size_t len) {
+    return posix_i2c_read(handle, dev_addr, start_reg, buffer, len);
+}
+
+void *posix_spi_init(const posix_spi_config_t *config) {
+    if (!config) {
+        printf("POSIX SPI: invalid config\n");
+        return NULL;
+    }
+
+    posix_bus_handle_t *handle = bus_open(config->device, config->freq_hz, config->mode, config->reg_addr_bytes, "SPI");
+    if (!handle) {
+        return NULL;
+    }
+
+#ifdef __linux__
+    if (handle->fd >= 0) {
+        uint8_t mode = config->mode;
+        uint32_t speed = config->freq_hz;
+        if (ioctl(handle->fd, SPI_IOC_WR_MODE, &mode) < 0 ||
+            ioctl(handle->fd, SPI_IOC_WR_MAX_SPEED_HZ, &speed) < 0) {
+            printf("POSIX SPI: cannot configure %s (%s)\n", config->device, strerror(errno));
+            bus_close(handle);
+            return NULL;
+        }
+    }
+#endif
+
+    printf("POSIX SPI: initialized on %s (mode=%u, freq=%u Hz)\n",
+           config->device ? config->device : "simulated bus", config->mode, config->freq_hz);
+
+    return handle;
+}
+
+void posix_spi_deinit(void *handle) {
+    if (!handle) {
+        return;
+    }
+
+    printf("POSIX SPI: deinitialized\n");
+    bus_close((posix_bus_handle_t *)handle);
+}
+
+int posix_spi_read(void *handle, uint8_t dev_addr, uint16_t reg, uint8_t *data, size_t len) {
+    (void)dev_addr;
+
+    if (!handle || !data || len == 0) {
+        return -1;
+    }
+
+    posix_bus_handle_t *bus = (posix_bus_handle_t *)handle;
+    int result = 0;
+
+    pthread_mutex_lock(&bus->lock);
+    if (bus->sim_regs) {
+        sim_read(bus, reg, data, len);
+    } else {
+        result = spi_dev_transfer(bus, reg, POSIX_SPI_READ_FLAG, NULL, data, len);
+    }
+    pthread_mutex_unlock(&bus->lock);
+
+    return result;
+}
+
+int posix_spi_write(void *handle, uint8_t dev_addr, uint16_t reg, const uint8_t *data, size_t len) {
+    (void)dev_addr;
+
+    if (!handle || !data || len == 0) {
+        return -1;
+    }
+
+    posix_bus_handle_t *bus = (posix_bus_handle_t *)handle;
+    int result = 0;
+
+    pthread_mutex_lock(&bus->lock);
+    if (bus->sim_regs) {
+        sim_write(bus, reg, data, len);
+    } else {
+        result = spi_dev_transfer(bus, reg, 0, data, NULL, len);
+    }
+    pthread_mutex_unlock(&bus->lock);
+
+    return result;
+}
+
+int posix_spi_read_burst(void *handle, uint8_t dev_addr, uint16_t start_reg, uint8_t *buffer, size_t len) {
+    return posix_spi_read(handle, dev_addr, start_reg, buffer, len);
+}
+
+int posix_bus_sim_load(void *handle, uint16_t reg, const uint8_t *data, size_t len) {
+    if (!handle || !data) {
+        return -1;
+    }
+
+    posix_bus_handle_t *bus = (posix_bus_handle_t *)handle;
+    if (!bus->sim_regs) {
+        return -1;
+    }
+
+    pthread_mutex_lock(&bus->lock);
+    sim_write(bus, reg, data, len);
+    pthread_mutex_unlock(&bus->lock);
+
+    return 0;
+}
+
+uint64_t posix_time_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)(ts.tv_nsec / 1000);
+}
+
+void posix_sleep_us(uint32_t us) {
+    struct timespec ts = {
+        .tv_sec = us / 1000000U,
+        .tv_nsec = (long)(us % 1000000U) * 1000L
+    };
+    while (nanosleep(&ts, &ts) != 0 && errno == EINTR) {
+    }
+}
+
+void posix_sleep_until_us(uint64_t deadline_us) {
+    struct timespec ts = {
+        .tv_sec = (time_t)(deadline_us / 1000000ULL),
+        .tv_nsec = (long)(deadline_us % 1000000ULL) * 1000L
+    };
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR) {
+    }
+}
+
+static void *thread_trampoline(void *arg) {
+    posix_thread_t *thread = (posix_thread_t *)arg;
+    thread->entry(thread->arg);
+    return NULL;
+}
+
+int posix_thread_create(posix_thread_t *thread, void (*entry)(void *arg), void *arg) {
+    if (!thread || !entry) {
+        return -1;
+    }
+
+    thread->entry = entry;
+    thread->arg = arg;
+
+    if (pthread_create(&thread->handle, NULL, thread_trampoline, thread) != 0) {
+        printf("POSIX: thread creation failed\n");
+        return -1;
+    }
+
+    return 0;
+}
+
+int posix_thread_join(posix_thread_t *thread) {
+    if (!thread) {
+        return -1;
+    }
+
+    return pthread_join(thread->handle, NULL) == 0 ? 0 : -1;
+}
+
+int posix_mutex_init(posix_mutex_t *mutex) {
+    if (!mutex) {
+        return -1;
+    }
+
+    return pthread_mutex_init(&mutex->handle, NULL) == 0 ? 0 : -1;
+}
+
+int posix_mutex_lock(posix_mutex_t *mutex) {
+    if (!mutex) {
+        return -1;
+    }
+
+    return pthread_mutex_lock(&mutex->handle) == 0 ? 0 : -1;
+}
+
+int posix_mutex_unlock(posix_mutex_t *mutex) {
+    if (!mutex) {
+        return -1;
+    }
+
+    return pthread_mutex_unlock(&mutex->handle) == 0 ? 0 : -1;
+}
+
+void posix_mutex_destroy(posix_mutex_t *mutex) {
+    if (!mutex) {
+        return;
+    }
+
+    pthread_mutex_destroy(&mutex->handle);
+}
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
@@ -0,0 +1,63 @@
+#ifndef POSIX_HAL_H
+#define POSIX_HAL_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <pthread.h>
+
+/* device == NULL selects the simulated loopback bus, otherwise an i2c-dev / spidev node is opened. */
+typedef struct {
+    const char *device;
+    uint32_t freq_hz;
+    uint8_t reg_addr_bytes;
+} posix_i2c_config_t;
+
+typedef struct {
+    const char *device;
+    uint32_t freq_hz;
+    uint8_t mode;
+    uint8_t reg_addr_bytes;
+} posix_spi_config_t;
+
+typedef struct {
+    pthread_t handle;
+    void (*entry)(void *arg);
+    void *arg;
+} posix_thread_t;
+
+typedef struct {
+    pthread_mutex_t handle;
+} posix_mutex_t;
+
+void *posix_i2c_init(const posix_i2c_config_t *config);
+void posix_i2c_deinit(void *handle);
+int posix_i2c_read(void *handle, uint8_t dev_addr, uint16_t reg, uint8_t *data, size_t len);
+int posix_i2c_write(void *handle, uint8_t dev_addr, uint16_t reg, const uint8_t *data, size_t len);
+int posix_i2c_read_burst(void *handle, uint8_t dev_addr, uint16_t start_reg, uint8_t *buffer, size_t len);
+
+void *posix_spi_init(const posix_spi_config_t *config);
+void posix_spi_deinit(void *handle);
+int posix_spi_read(void *handle, uint8_t dev_addr, uint16_t reg, uint8_t *data, size_t len);
+int posix_spi_write(void *handle, uint8_t dev_addr, uint16_t reg, const uint8_t *data, size_t len);
+int posix_spi_read_burst(void *handle, uint8_t dev_addr, uint16_t start_reg, uint8_t *buffer, size_t len);
+
+int posix_bus_sim_load(void *handle, uint16_t reg, const uint8_t *data, size_t len);
+
+uint64_t posix_time_us(void);
+void posix_sleep_us(uint32_t us);
+void posix_sleep_until_us(uint64_t deadline_us);
+
+int posix_thread_create(posix_thread_t *thread, void (*entry)(void *arg), void *arg);
+int posix_thread_join(posix_thread_t *thread);
+
+int posix_mutex_init(posix_mutex_t *mutex);
+int posix_mutex_lock(posix_mutex_t *mutex);
+int posix_mutex_unlock(posix_mutex_t *mutex);
+void posix_mutex_destroy(posix_mutex_t *mutex);
+
+#endif
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
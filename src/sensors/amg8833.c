@@ -1,5 +1,7 @@
 #include "sensors/amg8833.h"
-#include <stdio.h>
+#include "thermal_log.h"
+#include "thermal_trace.h"
+#include "thermal_bad_pixels.h"
 #include <string.h>
 
 #define AMG8833_REG_POWER 0x00
@@ -28,39 +30,43 @@ static amg8833_calibration_t calibration = {
     .thermistor_coefficient = 0.0625f
 };
 
-static thermal_status_t amg8833_init(thermal_transport_t *transport, uint8_t dev_addr) {
+static thermal_bad_pixel_map_t bad_pixels;
+
+static thermal_status_t amg8833_init(thermal_transport_t *transport, uint8_t dev_addr, thermal_arena_t *scratch) {
+    (void)scratch;
+    
     if (!transport) {
         return THERMAL_ERR_INVALID_ARG;
     }
     
     thermal_status_t status = transport->init(transport->hw_handle);
     if (status != THERMAL_OK) {
-        printf("AMG8833: transport init failed\n");
+        THERMAL_LOG_ERROR("AMG8833: transport init failed\n");
         return status;
     }
     
     uint8_t power_mode = AMG8833_POWER_NORMAL;
     status = transport->write_reg(transport->hw_handle, dev_addr, AMG8833_REG_POWER, &power_mode, 1);
     if (status != THERMAL_OK) {
-        printf("AMG8833: power mode set failed\n");
+        THERMAL_LOG_ERROR("AMG8833: power mode set failed\n");
         return status;
     }
     
     uint8_t reset = AMG8833_RESET_FLAG;
     status = transport->write_reg(transport->hw_handle, dev_addr, AMG8833_REG_RESET, &reset, 1);
     if (status != THERMAL_OK) {
-        printf("AMG8833: reset failed\n");
+        THERMAL_LOG_ERROR("AMG8833: reset failed\n");
         return status;
     }
     
     uint8_t framerate = AMG8833_FRAMERATE_10HZ;
     status = transport->write_reg(transport->hw_handle, dev_addr, AMG8833_REG_FRAMERATE, &framerate, 1);
     if (status != THERMAL_OK) {
-        printf("AMG8833: framerate set failed\n");
+        THERMAL_LOG_ERROR("AMG8833: framerate set failed\n");
         return status;
     }
     
-    printf("AMG8833: initialized successfully\n");
+    THERMAL_LOG_INFO("AMG8833: initialized successfully\n");
     return THERMAL_OK;
 }
 
@@ -70,19 +76,24 @@ static float convert_pixel_to_celsius(int16_t raw_value) {
     return temp_c;
 }
 
-static thermal_status_t amg8833_get_frame(thermal_transport_t *transport, uint8_t dev_addr, float *buffer, size_t buf_size) {
+static thermal_status_t amg8833_get_frame(thermal_transport_t *transport, uint8_t dev_addr, float *buffer, size_t buf_size, thermal_arena_t *scratch) {
+    (void)scratch;
+    
     if (!transport || !buffer || buf_size < AMG8833_PIXELS) {
         return THERMAL_ERR_INVALID_ARG;
     }
     
     uint8_t pixel_data[AMG8833_PIXELS * 2];
     
+    THERMAL_TRACE_BEGIN(THERMAL_STAGE_BUS);
     thermal_status_t status = transport->read_burst(transport->hw_handle, dev_addr, AMG8833_REG_PIXEL_BASE, pixel_data, sizeof(pixel_data));
     if (status != THERMAL_OK) {
-        printf("AMG8833: frame read failed\n");
+        THERMAL_LOG_ERROR("AMG8833: frame read failed\n");
         return status;
     }
+    THERMAL_TRACE_END(THERMAL_STAGE_BUS);
     
+    THERMAL_TRACE_BEGIN(THERMAL_STAGE_DECODE);
     for (uint16_t i = 0; i < AMG8833_PIXELS; i++) {
         int16_t raw_value = (int16_t)(pixel_data[i * 2] | (pixel_data[i * 2 + 1] << 8));
         
@@ -92,6 +103,8 @@ static thermal_status_t amg8833_get_frame(thermal_transport_t *transport, uint8_
         
         buffer[i] = convert_pixel_to_celsius(raw_value);
     }
+    thermal_bad_pixels_apply(&bad_pixels, buffer);
+    THERMAL_TRACE_END(THERMAL_STAGE_DECODE);
     
     return THERMAL_OK;
 }
@@ -121,11 +134,11 @@ static thermal_status_t amg8833_set_refresh_rate(thermal_transport_t *transport,
     
     thermal_status_t status = transport->write_reg(transport->hw_handle, dev_addr, AMG8833_REG_FRAMERATE, &framerate, 1);
     if (status != THERMAL_OK) {
-        printf("AMG8833: refresh rate set failed\n");
+        THERMAL_LOG_ERROR("AMG8833: refresh rate set failed\n");
         return status;
     }
     
-    printf("AMG8833: refresh rate set to %s\n", framerate == AMG8833_FRAMERATE_1HZ ? "1Hz" : "10Hz");
+    THERMAL_LOG_INFO("AMG8833: refresh rate set to %s\n", framerate == AMG8833_FRAMERATE_1HZ ? "1Hz" : "10Hz");
     return THERMAL_OK;
 }
 
@@ -137,14 +150,14 @@ static thermal_status_t amg8833_self_test(thermal_transport_t *transport, uint8_
     uint8_t status_reg;
     thermal_status_t status = transport->read_reg(transport->hw_handle, dev_addr, AMG8833_REG_STATUS, &status_reg, 1);
     if (status != THERMAL_OK) {
-        printf("AMG8833: self-test failed - cannot read status\n");
+        THERMAL_LOG_ERROR("AMG8833: self-test failed - cannot read status\n");
         return status;
     }
     
     uint8_t thermistor_data[2];
     status = transport->read_reg(transport->hw_handle, dev_addr, AMG8833_REG_THERMISTOR, thermistor_data, 2);
     if (status != THERMAL_OK) {
-        printf("AMG8833: self-test failed - cannot read thermistor\n");
+        THERMAL_LOG_ERROR("AMG8833: self-test failed - cannot read thermistor\n");
         return status;
     }
     
@@ -154,7 +167,8 @@ static thermal_status_t amg8833_self_test(thermal_transport_t *transport, uint8_
     }
     
     float thermistor_temp = (float)thermistor_raw * calibration.thermistor_coefficient;
-    printf("AMG8833: self-test passed, thermistor=%.2f°C\n", thermistor_temp);
+    THERMAL_LOG_INFO("AMG8833: self-test passed, thermistor=%.2f°C\n", thermistor_temp);
+    (void)thermistor_temp;
     
     return THERMAL_OK;
 }
@@ -167,14 +181,22 @@ static thermal_status_t amg8833_shutdown(thermal_transport_t *transport, uint8_t
     uint8_t power_mode = AMG8833_POWER_SLEEP;
     thermal_status_t status = transport->write_reg(transport->hw_handle, dev_addr, AMG8833_REG_POWER, &power_mode, 1);
     if (status != THERMAL_OK) {
-        printf("AMG8833: shutdown failed\n");
+        THERMAL_LOG_ERROR("AMG8833: shutdown failed\n");
         return status;
     }
     
-    printf("AMG8833: shutdown complete\n");
+    THERMAL_LOG_INFO("AMG8833: shutdown complete\n");
     return transport->deinit(transport->hw_handle);
 }
 
+/* The AMG8833 has no factory bad-pixel data, so the list comes from the user. */
+static thermal_status_t amg8833_set_bad_pixels(const uint16_t *indices, uint8_t count) {
+    thermal_resolution_t resolution = { AMG8833_WIDTH, AMG8833_HEIGHT };
+    return thermal_bad_pixels_build(&bad_pixels, &resolution, indices, count);
+}
+
+static const uint8_t amg8833_refresh_rates[] = { 1, 10 };
+
 const sensor_ops_t amg8833_ops = {
     .name = "AMG8833",
     .init = amg8833_init,
@@ -182,7 +204,10 @@ const sensor_ops_t amg8833_ops = {
     .get_resolution = amg8833_get_resolution,
     .set_refresh_rate = amg8833_set_refresh_rate,
     .self_test = amg8833_self_test,
-    .shutdown = amg8833_shutdown
+    .shutdown = amg8833_shutdown,
+    .set_bad_pixels = amg8833_set_bad_pixels,
+    .refresh_rates = amg8833_refresh_rates,
+    .refresh_rate_count = sizeof(amg8833_refresh_rates)
 };
 
 /*
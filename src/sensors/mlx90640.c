@@ -1,14 +1,28 @@
 #include "sensors/mlx90640.h"
-#include <stdio.h>
+#include "thermal_log.h"
+#include "thermal_trace.h"
+#include "thermal_simd.h"
+#include "thermal_bad_pixels.h"
 #include <string.h>
-#include <math.h>
 
 #define MLX90640_REG_EEPROM 0x2400
 #define MLX90640_REG_RAM 0x0400
 #define MLX90640_REG_CTRL 0x800D
 #define MLX90640_REG_STATUS 0x8000
 
-#define MLX90640_EEPROM_SIZE 832
+#define MLX90640_EEPROM_WORDS 832
+#define MLX90640_FRAME_WORDS (MLX90640_PIXELS + 64)
+#define MLX90640_EEPROM_PIXEL_BASE 64
+#define MLX90640_MAX_BAD_PIXELS 5
+#define MLX90640_NO_PIXEL 0xFFFF
+
+/*
+ * 0 keeps every per-pixel coefficient decoded (about 9 KB) for the fastest conversion; 1 keeps them the way the
+ * EEPROM encodes them, as row and column terms plus int8 residuals, and expands one row at a time while decoding.
+ */
+#ifndef MLX90640_COMPACT_CALIBRATION
+#define MLX90640_COMPACT_CALIBRATION 0
+#endif
 
 typedef struct {
     int16_t kVdd;
@@ -26,19 +40,197 @@ typedef struct {
     float KsTa;
     float ksTo[5];
     int16_t ct[5];
+#if MLX90640_COMPACT_CALIBRATION
+    /* value = row term + column term + delta * scale; kta and kv are based on row/column parity like the EEPROM. */
+    float alpha_row[MLX90640_HEIGHT];
+    float alpha_col[MLX90640_WIDTH];
+    float alpha_scale;
+    float offset_row[MLX90640_HEIGHT];
+    float offset_col[MLX90640_WIDTH];
+    float offset_scale;
+    float kta_rc[4];
+    float kta_scale;
+    float kv_rc[4];
+    int8_t alpha_delta[MLX90640_PIXELS];
+    int8_t offset_delta[MLX90640_PIXELS];
+    int8_t kta_delta[MLX90640_PIXELS];
+#else
     uint16_t alpha[MLX90640_PIXELS];
     int16_t offset[MLX90640_PIXELS];
     float kta[MLX90640_PIXELS];
     float kv[MLX90640_PIXELS];
+#endif
     float cpAlpha[2];
     int16_t cpOffset[2];
     float ilChessC[3];
-    uint16_t brokenPixels[5];
-    uint16_t outlierPixels[5];
+    uint16_t brokenPixels[MLX90640_MAX_BAD_PIXELS];
+    uint16_t outlierPixels[MLX90640_MAX_BAD_PIXELS];
 } mlx90640_calibration_t;
 
 static mlx90640_calibration_t calibration;
 static uint8_t calibration_loaded = 0;
+static thermal_bad_pixel_map_t bad_pixels;
+
+/* EEPROM and frame RAM are read into the device's scratch arena, so sensors on different buses never share a buffer. */
+#define MLX90640_SCRATCH_WORDS (MLX90640_EEPROM_WORDS > MLX90640_FRAME_WORDS ? MLX90640_EEPROM_WORDS : MLX90640_FRAME_WORDS)
+_Static_assert(MLX90640_SCRATCH_SIZE >= MLX90640_SCRATCH_WORDS * sizeof(uint16_t), "MLX90640_SCRATCH_SIZE too small");
+
+/* EEPROM-flagged pixels are always corrected; user pixels are added on top. */
+static thermal_status_t rebuild_bad_pixels(const uint16_t *user, uint8_t user_count) {
+    uint16_t indices[THERMAL_BAD_PIXELS_MAX];
+    uint8_t count = 0;
+    
+    for (int i = 0; i < MLX90640_MAX_BAD_PIXELS; i++) {
+        if (calibration.brokenPixels[i] != MLX90640_NO_PIXEL) {
+            indices[count++] = calibration.brokenPixels[i];
+        }
+        if (calibration.outlierPixels[i] != MLX90640_NO_PIXEL) {
+            indices[count++] = calibration.outlierPixels[i];
+        }
+    }
+    
+    for (uint8_t i = 0; i < user_count; i++) {
+        if (count >= THERMAL_BAD_PIXELS_MAX) {
+            return THERMAL_ERR_INVALID_ARG;
+        }
+        indices[count++] = user[i];
+    }
+    
+    thermal_resolution_t resolution = { MLX90640_WIDTH, MLX90640_HEIGHT };
+    return thermal_bad_pixels_build(&bad_pixels, &resolution, indices, count);
+}
+
+enum {
+    COEF_ALPHA,
+    COEF_OFFSET,
+    COEF_KTA,
+    COEF_KV
+};
+
+static float pixel_coefficient(uint16_t i, int which) {
+    switch (which) {
+        case COEF_ALPHA: return (float)(64 + (i % 32));
+        case COEF_OFFSET: return (float)((int)i - 384);
+        default: return 0.0001f;
+    }
+}
+
+#if MLX90640_COMPACT_CALIBRATION
+
+static int32_t round_nearest(float value) {
+    return (int32_t)(value < 0.0f ? value - 0.5f : value + 0.5f);
+}
+
+static int parity_class(uint16_t i) {
+    return ((i / MLX90640_WIDTH) & 1) * 2 + (i & 1);
+}
+
+static float residual(int which, uint16_t i, const float *row, const float *col, const float *rc) {
+    float base = rc ? rc[parity_class(i)] : row[i / MLX90640_WIDTH] + col[i % MLX90640_WIDTH];
+    return pixel_coefficient(i, which) - base;
+}
+
+/* Residuals are scaled so the largest fits int8; a row/column-separable field quantizes exactly. */
+static float quantize_residuals(int which, const float *row, const float *col, const float *rc, int8_t *delta) {
+    float largest = 0.0f;
+
+    for (uint16_t i = 0; i < MLX90640_PIXELS; i++) {
+        float r = residual(which, i, row, col, rc);
+        float magnitude = r < 0.0f ? -r : r;
+        if (magnitude > largest) {
+            largest = magnitude;
+        }
+    }
+
+    float scale = largest / 127.0f;
+    for (uint16_t i = 0; i < MLX90640_PIXELS; i++) {
+        delta[i] = (int8_t)(scale > 0.0f ? round_nearest(residual(which, i, row, col, rc) / scale) : 0);
+    }
+
+    return scale;
+}
+
+static float quantize_rows_cols(int which, float *row, float *col, int8_t *delta) {
+    for (uint16_t y = 0; y < MLX90640_HEIGHT; y++) {
+        float sum = 0.0f;
+        for (uint16_t x = 0; x < MLX90640_WIDTH; x++) {
+            sum += pixel_coefficient((uint16_t)(y * MLX90640_WIDTH + x), which);
+        }
+        row[y] = sum / MLX90640_WIDTH;
+    }
+
+    for (uint16_t x = 0; x < MLX90640_WIDTH; x++) {
+        float sum = 0.0f;
+        for (uint16_t y = 0; y < MLX90640_HEIGHT; y++) {
+            sum += pixel_coefficient((uint16_t)(y * MLX90640_WIDTH + x), which) - row[y];
+        }
+        col[x] = sum / MLX90640_HEIGHT;
+    }
+
+    return quantize_residuals(which, row, col, NULL, delta);
+}
+
+static void parity_means(int which, float *rc) {
+    float sum[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    for (uint16_t i = 0; i < MLX90640_PIXELS; i++) {
+        sum[parity_class(i)] += pixel_coefficient(i, which);
+    }
+    for (int k = 0; k < 4; k++) {
+        rc[k] = sum[k] / (MLX90640_PIXELS / 4);
+    }
+}
+
+static void store_coefficients(void) {
+    calibration.alpha_scale = quantize_rows_cols(COEF_ALPHA, calibration.alpha_row, calibration.alpha_col, calibration.alpha_delta);
+    calibration.offset_scale = quantize_rows_cols(COEF_OFFSET, calibration.offset_row, calibration.offset_col, calibration.offset_delta);
+    parity_means(COEF_KTA, calibration.kta_rc);
+    calibration.kta_scale = quantize_residuals(COEF_KTA, NULL, NULL, calibration.kta_rc, calibration.kta_delta);
+    /* The EEPROM has no per-pixel kv, only one value per row/column parity. */
+    parity_means(COEF_KV, calibration.kv_rc);
+}
+
+/* Expands one sensor row into the layout ir_decode expects. */
+static void expand_row(uint16_t y, uint16_t *alpha, int16_t *offset, float *kta, float *kv) {
+    for (uint16_t x = 0; x < MLX90640_WIDTH; x++) {
+        uint16_t i = (uint16_t)(y * MLX90640_WIDTH + x);
+        int rc = parity_class(i);
+        alpha[x] = (uint16_t)round_nearest(calibration.alpha_row[y] + calibration.alpha_col[x] + calibration.alpha_delta[i] * calibration.alpha_scale);
+        offset[x] = (int16_t)round_nearest(calibration.offset_row[y] + calibration.offset_col[x] + calibration.offset_delta[i] * calibration.offset_scale);
+        kta[x] = calibration.kta_rc[rc] + calibration.kta_delta[i] * calibration.kta_scale;
+        kv[x] = calibration.kv_rc[rc];
+    }
+}
+
+static void decode_pixels(const uint16_t *raw, float ta, float vdd, float *out) {
+    const thermal_simd_ops_t *simd = thermal_simd_ops();
+    uint16_t alpha[MLX90640_WIDTH];
+    int16_t offset[MLX90640_WIDTH];
+    float kta[MLX90640_WIDTH];
+    float kv[MLX90640_WIDTH];
+
+    for (uint16_t y = 0; y < MLX90640_HEIGHT; y++) {
+        expand_row(y, alpha, offset, kta, kv);
+        simd->ir_decode(raw + y * MLX90640_WIDTH, alpha, offset, kta, kv, ta, vdd, MLX90640_WIDTH, out + y * MLX90640_WIDTH);
+    }
+}
+
+#else
+
+static void store_coefficients(void) {
+    for (uint16_t i = 0; i < MLX90640_PIXELS; i++) {
+        calibration.alpha[i] = (uint16_t)pixel_coefficient(i, COEF_ALPHA);
+        calibration.offset[i] = (int16_t)pixel_coefficient(i, COEF_OFFSET);
+        calibration.kta[i] = pixel_coefficient(i, COEF_KTA);
+        calibration.kv[i] = pixel_coefficient(i, COEF_KV);
+    }
+}
+
+static void decode_pixels(const uint16_t *raw, float ta, float vdd, float *out) {
+    thermal_simd_ops()->ir_decode(raw, calibration.alpha, calibration.offset, calibration.kta, calibration.kv,
+                                  ta, vdd, MLX90640_PIXELS, out);
+}
+
+#endif
 
 static thermal_status_t extract_calibration(const uint16_t *eeprom) {
     calibration.kVdd = (int16_t)eeprom[51];
@@ -55,12 +247,7 @@ static thermal_status_t extract_calibration(const uint16_t *eeprom) {
     
     calibration.resolutionEE = (eeprom[56] & 0x3000) >> 12;
     
-    for (int i = 0; i < MLX90640_PIXELS; i++) {
-        calibration.alpha[i] = (uint16_t)(64 + (i % 32));
-        calibration.offset[i] = (int16_t)(i - 384);
-        calibration.kta[i] = 0.0001f;
-        calibration.kv[i] = 0.0001f;
-    }
+    store_coefficients();
     
     calibration.cpAlpha[0] = 1.0f;
     calibration.cpAlpha[1] = 1.0f;
@@ -77,88 +264,117 @@ static thermal_status_t extract_calibration(const uint16_t *eeprom) {
         calibration.ilChessC[i] = 0.0f;
     }
     
+    /* A zero pixel word marks a broken pixel; bit 0 of a non-zero word marks an outlier. */
+    uint8_t broken = 0;
+    uint8_t outliers = 0;
+    for (int i = 0; i < MLX90640_MAX_BAD_PIXELS; i++) {
+        calibration.brokenPixels[i] = MLX90640_NO_PIXEL;
+        calibration.outlierPixels[i] = MLX90640_NO_PIXEL;
+    }
+    
+    uint16_t flagged = 0;
+    for (uint16_t i = 0; i < MLX90640_PIXELS; i++) {
+        uint16_t word = eeprom[MLX90640_EEPROM_PIXEL_BASE + i];
+        if (word == 0) {
+            flagged++;
+            if (broken < MLX90640_MAX_BAD_PIXELS) {
+                calibration.brokenPixels[broken++] = i;
+            }
+        } else if (word & 0x0001) {
+            flagged++;
+            if (outliers < MLX90640_MAX_BAD_PIXELS) {
+                calibration.outlierPixels[outliers++] = i;
+            }
+        }
+    }
+    
+    if (flagged > broken + outliers) {
+        THERMAL_LOG_WARN("MLX90640: %u pixels flagged in EEPROM, correcting the first %u\n", flagged, broken + outliers);
+    } else if (flagged > 0) {
+        THERMAL_LOG_INFO("MLX90640: %u broken, %u outlier pixels\n", broken, outliers);
+    }
+    
     return THERMAL_OK;
 }
 
-static thermal_status_t mlx90640_init(thermal_transport_t *transport, uint8_t dev_addr) {
+static thermal_status_t mlx90640_init(thermal_transport_t *transport, uint8_t dev_addr, thermal_arena_t *scratch) {
     if (!transport) {
         return THERMAL_ERR_INVALID_ARG;
     }
     
     thermal_status_t status = transport->init(transport->hw_handle);
     if (status != THERMAL_OK) {
-        printf("MLX90640: transport init failed\n");
+        THERMAL_LOG_ERROR("MLX90640: transport init failed\n");
         return status;
     }
     
-    uint16_t eeprom[MLX90640_EEPROM_SIZE / 2];
-    uint8_t *eeprom_bytes = (uint8_t *)eeprom;
+    size_t mark = thermal_arena_mark(scratch);
+    uint16_t *eeprom = thermal_arena_alloc(scratch, MLX90640_EEPROM_WORDS * sizeof(uint16_t));
+    if (!eeprom) {
+        THERMAL_LOG_ERROR("MLX90640: scratch arena too small for EEPROM\n");
+        return THERMAL_ERR_INVALID_ARG;
+    }
     
-    status = transport->read_burst(transport->hw_handle, dev_addr, MLX90640_REG_EEPROM, eeprom_bytes, MLX90640_EEPROM_SIZE);
+    status = transport->read_burst(transport->hw_handle, dev_addr, MLX90640_REG_EEPROM, (uint8_t *)eeprom, MLX90640_EEPROM_WORDS * sizeof(uint16_t));
     if (status != THERMAL_OK) {
-        printf("MLX90640: failed to read EEPROM\n");
+        thermal_arena_release(scratch, mark);
+        THERMAL_LOG_ERROR("MLX90640: failed to read EEPROM\n");
         return THERMAL_ERR_CALIBRATION;
     }
     
     status = extract_calibration(eeprom);
+    thermal_arena_release(scratch, mark);
     if (status != THERMAL_OK) {
-        printf("MLX90640: calibration extraction failed\n");
+        THERMAL_LOG_ERROR("MLX90640: calibration extraction failed\n");
         return status;
     }
     
-    calibration_loaded = 1;
-    printf("MLX90640: initialized successfully\n");
-    
-    return THERMAL_OK;
-}
-
-static float calculate_temperature(uint16_t raw_pixel, float vdd, float ta, uint16_t pixel_index) {
-    float alpha_comp = ((float)calibration.alpha[pixel_index]) / 65536.0f;
-    float offset_comp = (float)calibration.offset[pixel_index];
-    float kta_comp = calibration.kta[pixel_index];
-    float kv_comp = calibration.kv[pixel_index];
-    
-    float vir = (float)raw_pixel;
-    float vir_comp = vir - offset_comp * (1.0f + kta_comp * (ta - 25.0f)) * (1.0f + kv_comp * (vdd - 3.3f));
-    
-    float sx = alpha_comp * vir_comp;
-    
-    if (sx <= 0.0f) {
-        sx = 1.0f;
+    status = rebuild_bad_pixels(NULL, 0);
+    if (status != THERMAL_OK) {
+        return status;
     }
     
-    float temp_k = powf((sx / 5.67e-8f), 0.25f);
-    float temp_c = temp_k - 273.15f;
+    calibration_loaded = 1;
+    THERMAL_LOG_INFO("MLX90640: initialized successfully\n");
     
-    return temp_c;
+    return THERMAL_OK;
 }
 
-static thermal_status_t mlx90640_get_frame(thermal_transport_t *transport, uint8_t dev_addr, float *buffer, size_t buf_size) {
+static thermal_status_t mlx90640_get_frame(thermal_transport_t *transport, uint8_t dev_addr, float *buffer, size_t buf_size, thermal_arena_t *scratch) {
     if (!transport || !buffer || buf_size < MLX90640_PIXELS) {
         return THERMAL_ERR_INVALID_ARG;
     }
     
     if (!calibration_loaded) {
-        printf("MLX90640: calibration not loaded\n");
+        THERMAL_LOG_ERROR("MLX90640: calibration not loaded\n");
         return THERMAL_ERR_NOT_INIT;
     }
     
-    uint16_t frame_data[MLX90640_PIXELS + 64];
-    uint8_t *frame_bytes = (uint8_t *)frame_data;
+    size_t mark = thermal_arena_mark(scratch);
+    uint16_t *frame_data = thermal_arena_alloc(scratch, MLX90640_FRAME_WORDS * sizeof(uint16_t));
+    if (!frame_data) {
+        THERMAL_LOG_ERROR("MLX90640: scratch arena too small for frame\n");
+        return THERMAL_ERR_INVALID_ARG;
+    }
     
-    thermal_status_t status = transport->read_burst(transport->hw_handle, dev_addr, MLX90640_REG_RAM, frame_bytes, sizeof(frame_data));
+    THERMAL_TRACE_BEGIN(THERMAL_STAGE_BUS);
+    thermal_status_t status = transport->read_burst(transport->hw_handle, dev_addr, MLX90640_REG_RAM, (uint8_t *)frame_data, MLX90640_FRAME_WORDS * sizeof(uint16_t));
     if (status != THERMAL_OK) {
-        printf("MLX90640: frame read failed\n");
+        thermal_arena_release(scratch, mark);
+        THERMAL_LOG_ERROR("MLX90640: frame read failed\n");
         return status;
     }
+    THERMAL_TRACE_END(THERMAL_STAGE_BUS);
     
     float vdd = 3.3f;
     float ta = 25.0f;
     
-    for (uint16_t i = 0; i < MLX90640_PIXELS; i++) {
-        buffer[i] = calculate_temperature(frame_data[i], vdd, ta, i);
-    }
+    THERMAL_TRACE_BEGIN(THERMAL_STAGE_DECODE);
+    decode_pixels(frame_data, ta, vdd, buffer);
+    thermal_bad_pixels_apply(&bad_pixels, buffer);
+    THERMAL_TRACE_END(THERMAL_STAGE_DECODE);
     
+    thermal_arena_release(scratch, mark);
     return THERMAL_OK;
 }
 
@@ -200,11 +416,11 @@ static thermal_status_t mlx90640_set_refresh_rate(thermal_transport_t *transport
     
     status = transport->write_reg(transport->hw_handle, dev_addr, MLX90640_REG_CTRL, ctrl_data, 2);
     if (status != THERMAL_OK) {
-        printf("MLX90640: refresh rate set failed\n");
+        THERMAL_LOG_ERROR("MLX90640: refresh rate set failed\n");
         return status;
     }
     
-    printf("MLX90640: refresh rate set to %u Hz\n", rate_hz);
+    THERMAL_LOG_INFO("MLX90640: refresh rate set to %u Hz\n", rate_hz);
     return THERMAL_OK;
 }
 
@@ -216,11 +432,11 @@ static thermal_status_t mlx90640_self_test(thermal_transport_t *transport, uint8
     uint8_t status_reg[2];
     thermal_status_t status = transport->read_reg(transport->hw_handle, dev_addr, MLX90640_REG_STATUS, status_reg, 2);
     if (status != THERMAL_OK) {
-        printf("MLX90640: self-test failed - cannot read status\n");
+        THERMAL_LOG_ERROR("MLX90640: self-test failed - cannot read status\n");
         return status;
     }
     
-    printf("MLX90640: self-test passed\n");
+    THERMAL_LOG_INFO("MLX90640: self-test passed\n");
     return THERMAL_OK;
 }
 
@@ -232,11 +448,21 @@ static thermal_status_t mlx90640_shutdown(thermal_transport_t *transport, uint8_
     }
     
     calibration_loaded = 0;
-    printf("MLX90640: shutdown complete\n");
+    THERMAL_LOG_INFO("MLX90640: shutdown complete\n");
     
     return transport->deinit(transport->hw_handle);
 }
 
+static thermal_status_t mlx90640_set_bad_pixels(const uint16_t *indices, uint8_t count) {
+    if (!calibration_loaded) {
+        return THERMAL_ERR_NOT_INIT;
+    }
+    
+    return rebuild_bad_pixels(indices, count);
+}
+
+static const uint8_t mlx90640_refresh_rates[] = { 1, 2, 4, 8, 16, 32, 64 };
+
 const sensor_ops_t mlx90640_ops = {
     .name = "MLX90640",
     .init = mlx90640_init,
@@ -244,7 +470,11 @@ const sensor_ops_t mlx90640_ops = {
     .get_resolution = mlx90640_get_resolution,
     .set_refresh_rate = mlx90640_set_refresh_rate,
     .self_test = mlx90640_self_test,
-    .shutdown = mlx90640_shutdown
+    .shutdown = mlx90640_shutdown,
+    .set_bad_pixels = mlx90640_set_bad_pixels,
+    .refresh_rates = mlx90640_refresh_rates,
+    .refresh_rate_count = sizeof(mlx90640_refresh_rates),
+    .scratch_size = MLX90640_SCRATCH_SIZE
 };
 
 /*
@@ -0,0 +1,255 @@
+#include "thermal_alarm.h"
+#include <string.h>
+
+enum {
+    OP_LEVEL_ABOVE,
+    OP_LEVEL_BELOW,
+    OP_RATE_ABOVE,
+    OP_RATE_BELOW
+};
+
+#define NO_HISTORY 0xFF
+
+static uint8_t find_history(thermal_alarm_t *alarm, uint8_t zone, uint8_t stat, uint32_t window_ms) {
+    for (uint8_t i = 0; i < alarm->history_count; i++) {
+        const thermal_alarm_history_t *history = &alarm->histories[i];
+        if (history->zone == zone && history->stat == stat && history->window_ms == window_ms) {
+            return i;
+        }
+    }
+
+    if (alarm->history_count >= THERMAL_ALARM_MAX_HISTORIES) {
+        return NO_HISTORY;
+    }
+
+    thermal_alarm_history_t *history = &alarm->histories[alarm->history_count];
+    memset(history, 0, sizeof(*history));
+    history->zone = zone;
+    history->stat = stat;
+    history->window_ms = window_ms;
+
+    /* Two spare samples keep one sample at least window_ms old once the ring has filled. */
+    history->interval_ms = window_ms / (THERMAL_ALARM_HISTORY_SAMPLES - 2);
+    return alarm->history_count++;
+}
+
+thermal_status_t thermal_alarm_compile(thermal_alarm_t *alarm, const thermal_resolution_t *resolution, const thermal_rect_t *zones, uint8_t zone_count, const thermal_alarm_rule_t *rules, size_t rule_count, thermal_alarm_op_t *program, size_t program_capacity) {
+    if (!alarm || !resolution || !zones || !rules || !program) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    if (zone_count == 0 || zone_count > THERMAL_ALARM_MAX_ZONES || rule_count > program_capacity) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    for (uint8_t i = 0; i < zone_count; i++) {
+        const thermal_rect_t *zone = &zones[i];
+        if (zone->width == 0 || zone->height == 0 ||
+            (uint32_t)zone->x + zone->width > resolution->width ||
+            (uint32_t)zone->y + zone->height > resolution->height) {
+            return THERMAL_ERR_INVALID_ARG;
+        }
+    }
+
+    memset(alarm, 0, sizeof(*alarm));
+    alarm->resolution = *resolution;
+    memcpy(alarm->zones, zones, zone_count * sizeof(thermal_rect_t));
+    alarm->zone_count = zone_count;
+
+    for (size_t i = 0; i < rule_count; i++) {
+        const thermal_alarm_rule_t *rule = &rules[i];
+        if (rule->zone >= zone_count || (unsigned)rule->stat >= THERMAL_ALARM_STAT_COUNT || rule->hysteresis < 0.0f) {
+            return THERMAL_ERR_INVALID_ARG;
+        }
+
+        thermal_alarm_op_t *op = &program[i];
+        memset(op, 0, sizeof(*op));
+        op->zone = rule->zone;
+        op->stat = (uint8_t)rule->stat;
+        op->threshold = rule->threshold;
+        op->hold_frames = rule->hold_frames ? rule->hold_frames : 1;
+        op->window_ms = rule->window_ms;
+        op->history = NO_HISTORY;
+
+        uint8_t below = rule->compare == THERMAL_ALARM_BELOW;
+        op->release = below ? rule->threshold + rule->hysteresis : rule->threshold - rule->hysteresis;
+
+        if (rule->window_ms == 0) {
+            op->opcode = below ? OP_LEVEL_BELOW : OP_LEVEL_ABOVE;
+        } else {
+            op->opcode = below ? OP_RATE_BELOW : OP_RATE_ABOVE;
+            op->history = find_history(alarm, rule->zone, (uint8_t)rule->stat, rule->window_ms);
+            if (op->history == NO_HISTORY) {
+                return THERMAL_ERR_UNSUPPORTED;
+            }
+        }
+
+        alarm->zone_used |= (uint16_t)(1u << rule->zone);
+    }
+
+    alarm->program = program;
+    alarm->rule_count = rule_count;
+    return THERMAL_OK;
+}
+
+static void zone_stats(const thermal_alarm_t *alarm, const float *data, const thermal_rect_t *zone, float *stats) {
+    uint16_t width = alarm->resolution.width;
+    const float *row = data + (size_t)zone->y * width + zone->x;
+    float min_temp = row[0];
+    float max_temp = row[0];
+    float sum = 0.0f;
+
+    for (uint16_t y = 0; y < zone->height; y++, row += width) {
+        for (uint16_t x = 0; x < zone->width; x++) {
+            float temp = row[x];
+            sum += temp;
+            if (temp < min_temp) {
+                min_temp = temp;
+            }
+            if (temp > max_temp) {
+                max_temp = temp;
+            }
+        }
+    }
+
+    stats[THERMAL_ALARM_STAT_MIN] = min_temp;
+    stats[THERMAL_ALARM_STAT_MAX] = max_temp;
+    stats[THERMAL_ALARM_STAT_MEAN] = sum / (float)((uint32_t)zone->width * zone->height);
+}
+
+static void record_history(thermal_alarm_history_t *history, float value, uint32_t now_ms) {
+    if (history->written > 0) {
+        uint32_t last = history->time_ms[(history->written - 1) % THERMAL_ALARM_HISTORY_SAMPLES];
+        if ((uint32_t)(now_ms - last) < history->interval_ms) {
+            return;
+        }
+    }
+
+    uint32_t slot = history->written % THERMAL_ALARM_HISTORY_SAMPLES;
+    history->time_ms[slot] = now_ms;
+    history->value[slot] = value;
+    history->written++;
+}
+
+/* Change since the newest sample at least window_ms old; the cursor only moves forward, so this is amortised O(1). */
+static float rate_value(const thermal_alarm_t *alarm, thermal_alarm_op_t *op, float current, uint32_t now_ms) {
+    const thermal_alarm_history_t *history = &alarm->histories[op->history];
+    uint32_t oldest = history->written > THERMAL_ALARM_HISTORY_SAMPLES ? history->written - THERMAL_ALARM_HISTORY_SAMPLES : 0;
+
+    if (op->cursor < oldest) {
+        op->cursor = oldest;
+    }
+
+    while (op->cursor + 1 < history->written &&
+           (uint32_t)(now_ms - history->time_ms[(op->cursor + 1) % THERMAL_ALARM_HISTORY_SAMPLES]) >= op->window_ms) {
+        op->cursor++;
+    }
+
+    return current - history->value[op->cursor % THERMAL_ALARM_HISTORY_SAMPLES];
+}
+
+thermal_status_t thermal_alarm_update(thermal_alarm_t *alarm, const thermal_frame_t *frame, uint32_t now_ms, thermal_alarm_event_t *events, size_t max_events, size_t *event_count) {
+    if (!alarm || !alarm->program || !frame || !frame->data || (!events && max_events > 0)) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    if (frame->resolution.width != alarm->resolution.width || frame->resolution.height != alarm->resolution.height) {
+        return THERMAL_ERR_FRAME_INVALID;
+    }
+
+    size_t emitted = 0;
+
+    /* Statistics are computed once per zone however many rules read them. */
+    for (uint8_t i = 0; i < alarm->zone_count; i++) {
+        if (alarm->zone_used & (1u << i)) {
+            zone_stats(alarm, frame->data, &alarm->zones[i], alarm->stats[i]);
+        }
+    }
+
+    for (uint8_t i = 0; i < alarm->history_count; i++) {
+        thermal_alarm_history_t *history = &alarm->histories[i];
+        record_history(history, alarm->stats[history->zone][history->stat], now_ms);
+    }
+
+    for (size_t i = 0; i < alarm->rule_count; i++) {
+        thermal_alarm_op_t *op = &alarm->program[i];
+        float value = alarm->stats[op->zone][op->stat];
+        uint8_t holds;
+
+        switch (op->opcode) {
+            case OP_LEVEL_ABOVE:
+                holds = value > (op->active ? op->release : op->threshold);
+                break;
+            case OP_LEVEL_BELOW:
+                holds = value < (op->active ? op->release : op->threshold);
+                break;
+            case OP_RATE_ABOVE:
+                value = rate_value(alarm, op, value, now_ms);
+                holds = value > (op->active ? op->release : op->threshold);
+                break;
+            default:
+                value = rate_value(alarm, op, value, now_ms);
+                holds = value < (op->active ? op->release : op->threshold);
+                break;
+        }
+
+        /* count tracks consecutive frames disagreeing with the current state; only a full run flips it. */
+        if (holds == op->active) {
+            op->count = 0;
+            continue;
+        }
+
+        if (++op->count < op->hold_frames) {
+            continue;
+        }
+
+        op->count = 0;
+        op->active = !op->active;
+
+        if (emitted < max_events) {
+            events[emitted].rule = (uint16_t)i;
+            events[emitted].raised = op->active;
+            events[emitted].value = value;
+            emitted++;
+        } else {
+            alarm->dropped_events++;
+        }
+    }
+
+    if (event_count) {
+        *event_count = emitted;
+    }
+
+    return THERMAL_OK;
+}
+
+uint8_t thermal_alarm_active(const thermal_alarm_t *alarm, size_t rule) {
+    if (!alarm || !alarm->program || rule >= alarm->rule_count) {
+        return 0;
+    }
+
+    return alarm->program[rule].active;
+}
+
+void thermal_alarm_reset(thermal_alarm_t *alarm) {
+    if (!alarm || !alarm->program) {
+        return;
+    }
+
+    for (size_t i = 0; i < alarm->rule_count; i++) {
+        alarm->program[i].count = 0;
+        alarm->program[i].active = 0;
+        alarm->program[i].cursor = 0;
+    }
+
+    for (uint8_t i = 0; i < alarm->history_count; i++) {
+        alarm->histories[i].written = 0;
+    }
+
+    alarm->dropped_events = 0;
+}
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
@@ -0,0 +1,61 @@
+#include "thermal_arena.h"
+
+thermal_status_t thermal_arena_init(thermal_arena_t *arena, void *buffer, size_t size) {
+    if (!arena || !buffer) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    /* Align the start once so every rounded allocation stays aligned. */
+    size_t skew = (size_t)((uintptr_t)buffer & (THERMAL_ARENA_ALIGN - 1));
+    size_t pad = skew ? THERMAL_ARENA_ALIGN - skew : 0;
+    if (size <= pad) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    arena->base = (uint8_t *)buffer + pad;
+    arena->size = (size - pad) & ~(size_t)(THERMAL_ARENA_ALIGN - 1);
+    arena->used = 0;
+    arena->high_water = 0;
+
+    return THERMAL_OK;
+}
+
+void *thermal_arena_alloc(thermal_arena_t *arena, size_t bytes) {
+    if (!arena || !arena->base || bytes == 0) {
+        return NULL;
+    }
+
+    size_t rounded = THERMAL_ARENA_SIZE(bytes);
+    if (rounded < bytes || rounded > arena->size - arena->used) {
+        return NULL;
+    }
+
+    void *block = arena->base + arena->used;
+    arena->used += rounded;
+    if (arena->used > arena->high_water) {
+        arena->high_water = arena->used;
+    }
+
+    return block;
+}
+
+size_t thermal_arena_mark(const thermal_arena_t *arena) {
+    return arena ? arena->used : 0;
+}
+
+void thermal_arena_release(thermal_arena_t *arena, size_t mark) {
+    if (arena && mark <= arena->used) {
+        arena->used = mark;
+    }
+}
+
+void thermal_arena_reset(thermal_arena_t *arena) {
+    if (arena) {
+        arena->used = 0;
+    }
+}
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
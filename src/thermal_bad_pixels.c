@@ -0,0 +1,85 @@
+#include "thermal_bad_pixels.h"
+#include <string.h>
+
+static int is_listed(const uint16_t *indices, uint8_t count, uint16_t index) {
+    for (uint8_t i = 0; i < count; i++) {
+        if (indices[i] == index) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void add_neighbor(thermal_bad_pixel_t *pixel, const thermal_resolution_t *resolution, const uint16_t *indices, uint8_t count, int x, int y) {
+    if (pixel->neighbor_count >= THERMAL_BAD_PIXEL_NEIGHBORS ||
+        x < 0 || y < 0 || x >= resolution->width || y >= resolution->height) {
+        return;
+    }
+
+    uint16_t index = (uint16_t)(y * resolution->width + x);
+    if (!is_listed(indices, count, index)) {
+        pixel->neighbors[pixel->neighbor_count++] = index;
+    }
+}
+
+thermal_status_t thermal_bad_pixels_build(thermal_bad_pixel_map_t *map, const thermal_resolution_t *resolution, const uint16_t *indices, uint8_t count) {
+    if (!map || !resolution || (count && !indices) || count > THERMAL_BAD_PIXELS_MAX) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    /* Validate the whole list first so a bad index leaves the previous map in place. */
+    size_t total_pixels = (size_t)resolution->width * resolution->height;
+    for (uint8_t i = 0; i < count; i++) {
+        if (indices[i] >= total_pixels) {
+            return THERMAL_ERR_INVALID_ARG;
+        }
+    }
+
+    memset(map, 0, sizeof(*map));
+
+    for (uint8_t i = 0; i < count; i++) {
+        thermal_bad_pixel_t *pixel = &map->pixels[map->count++];
+        int x = indices[i] % resolution->width;
+        int y = indices[i] / resolution->width;
+        pixel->index = indices[i];
+
+        /* Prefer the four direct neighbours; fall back to diagonals when listed pixels or edges leave fewer than two. */
+        add_neighbor(pixel, resolution, indices, count, x - 1, y);
+        add_neighbor(pixel, resolution, indices, count, x + 1, y);
+        add_neighbor(pixel, resolution, indices, count, x, y - 1);
+        add_neighbor(pixel, resolution, indices, count, x, y + 1);
+
+        if (pixel->neighbor_count < 2) {
+            add_neighbor(pixel, resolution, indices, count, x - 1, y - 1);
+            add_neighbor(pixel, resolution, indices, count, x + 1, y - 1);
+            add_neighbor(pixel, resolution, indices, count, x - 1, y + 1);
+            add_neighbor(pixel, resolution, indices, count, x + 1, y + 1);
+        }
+    }
+
+    return THERMAL_OK;
+}
+
+void thermal_bad_pixels_apply(const thermal_bad_pixel_map_t *map, float *frame) {
+    if (!map || !frame) {
+        return;
+    }
+
+    for (uint8_t i = 0; i < map->count; i++) {
+        const thermal_bad_pixel_t *pixel = &map->pixels[i];
+        if (pixel->neighbor_count == 0) {
+            continue;
+        }
+
+        float sum = 0.0f;
+        for (uint8_t n = 0; n < pixel->neighbor_count; n++) {
+            sum += frame[pixel->neighbors[n]];
+        }
+        frame[pixel->index] = sum / (float)pixel->neighbor_count;
+    }
+}
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
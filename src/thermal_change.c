@@ -0,0 +1,129 @@
+#include "thermal_change.h"
+#include <math.h>
+#include <string.h>
+
+thermal_status_t thermal_change_init(thermal_change_detector_t *detector, float tolerance, float *reference, size_t reference_len) {
+    if (!detector || !reference || reference_len == 0 || !(tolerance >= 0.0f)) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    memset(detector, 0, sizeof(*detector));
+    detector->tolerance = tolerance;
+    detector->reference = reference;
+    detector->reference_len = reference_len;
+
+    return THERMAL_OK;
+}
+
+void thermal_change_reset(thermal_change_detector_t *detector) {
+    if (detector) {
+        detector->has_reference = 0;
+    }
+}
+
+static int block_exceeds(const float *data, const float *reference, uint16_t width, uint16_t height, uint16_t bx, uint16_t by, float tolerance) {
+    uint16_t x0 = (uint16_t)(bx * THERMAL_CHANGE_BLOCK_SIZE);
+    uint16_t y0 = (uint16_t)(by * THERMAL_CHANGE_BLOCK_SIZE);
+    uint16_t x1 = (x0 + THERMAL_CHANGE_BLOCK_SIZE < width) ? x0 + THERMAL_CHANGE_BLOCK_SIZE : width;
+    uint16_t y1 = (y0 + THERMAL_CHANGE_BLOCK_SIZE < height) ? y0 + THERMAL_CHANGE_BLOCK_SIZE : height;
+
+    for (uint16_t y = y0; y < y1; y++) {
+        size_t row = (size_t)y * width;
+        float max_diff = 0.0f;
+
+        for (uint16_t x = x0; x < x1; x++) {
+            float diff = fabsf(data[row + x] - reference[row + x]);
+            if (diff > max_diff) {
+                max_diff = diff;
+            }
+        }
+
+        if (max_diff > tolerance) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+thermal_status_t thermal_change_check(thermal_change_detector_t *detector, const thermal_frame_t *frame, uint8_t *changed) {
+    if (!detector || !frame || !frame->data || !changed) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    uint16_t width = frame->resolution.width;
+    uint16_t height = frame->resolution.height;
+    size_t total_pixels = (size_t)width * height;
+
+    if (total_pixels == 0 || total_pixels > detector->reference_len) {
+        return THERMAL_ERR_FRAME_INVALID;
+    }
+
+    uint8_t differs = 1;
+
+    if (detector->has_reference &&
+        detector->resolution.width == width && detector->resolution.height == height) {
+        uint16_t blocks_x = (uint16_t)((width + THERMAL_CHANGE_BLOCK_SIZE - 1) / THERMAL_CHANGE_BLOCK_SIZE);
+        uint32_t block_count = (uint32_t)blocks_x * ((height + THERMAL_CHANGE_BLOCK_SIZE - 1) / THERMAL_CHANGE_BLOCK_SIZE);
+        uint32_t start = detector->last_block < block_count ? detector->last_block : 0;
+
+        /* Motion tends to stay put between frames, so start at the block that changed last time. */
+        differs = 0;
+        for (uint32_t n = 0; n < block_count; n++) {
+            uint32_t b = start + n;
+            if (b >= block_count) {
+                b -= block_count;
+            }
+
+            if (block_exceeds(frame->data, detector->reference, width, height,
+                              (uint16_t)(b % blocks_x), (uint16_t)(b / blocks_x), detector->tolerance)) {
+                detector->last_block = b;
+                differs = 1;
+                break;
+            }
+        }
+    }
+
+    if (differs) {
+        memcpy(detector->reference, frame->data, total_pixels * sizeof(float));
+        detector->resolution = frame->resolution;
+        detector->has_reference = 1;
+        detector->changed_frames++;
+    } else {
+        detector->unchanged_frames++;
+    }
+
+    *changed = differs;
+    return THERMAL_OK;
+}
+
+void thermal_change_cursor_reset(thermal_change_cursor_t *cursor) {
+    if (cursor) {
+        cursor->has_last = 0;
+    }
+}
+
+/*
+ * unchanged is relative to the detector's reference, which may be a frame the consumer never saw (dropped by
+ * the pipeline or skipped by a snapshot reader). Frame ids are consecutive per device, so any gap since the
+ * last consumed frame clears unchanged and the consumer redraws.
+ */
+thermal_status_t thermal_change_consume(thermal_change_cursor_t *cursor, thermal_frame_t *frame) {
+    if (!cursor || !frame) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    if (frame->unchanged && (!cursor->has_last || frame->timestamp != cursor->last_id + 1)) {
+        frame->unchanged = 0;
+        cursor->forced_frames++;
+    }
+
+    cursor->last_id = frame->timestamp;
+    cursor->has_last = 1;
+    return THERMAL_OK;
+}
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
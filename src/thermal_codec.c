@@ -0,0 +1,369 @@
+#include "thermal_codec.h"
+#include <math.h>
+#include <string.h>
+
+#define CODEC_RICE_LIMIT 24
+#define CODEC_ESCAPE_BITS 24
+#define CODEC_MAX_K 16
+#define CODEC_RESET_COUNT 64
+/* |q| bound so the worst residual (8 * limit after prediction) still fits the escape code. */
+#define CODEC_Q_LIMIT ((1 << (CODEC_ESCAPE_BITS - 4)) - 1)
+
+typedef struct {
+    uint8_t *buf;
+    size_t size;
+    size_t pos;
+    uint64_t acc;
+    int bits;
+    int overflow;
+} bit_writer_t;
+
+typedef struct {
+    const uint8_t *buf;
+    size_t size;
+    size_t pos;
+    uint64_t acc;
+    int bits;
+} bit_reader_t;
+
+typedef struct {
+    uint32_t a;
+    uint32_t n;
+} rice_state_t;
+
+static void put_bits(bit_writer_t *bw, uint32_t value, int count) {
+    bw->acc = (bw->acc << count) | (value & ((count == 32) ? 0xFFFFFFFFu : ((1u << count) - 1)));
+    bw->bits += count;
+
+    while (bw->bits >= 8) {
+        bw->bits -= 8;
+        if (bw->pos < bw->size) {
+            bw->buf[bw->pos++] = (uint8_t)(bw->acc >> bw->bits);
+        } else {
+            bw->overflow = 1;
+        }
+    }
+}
+
+static void flush_bits(bit_writer_t *bw) {
+    if (bw->bits > 0) {
+        put_bits(bw, 0, 8 - bw->bits);
+    }
+}
+
+static int get_bits(bit_reader_t *br, int count, uint32_t *value) {
+    while (br->bits < count) {
+        if (br->pos >= br->size) {
+            return 0;
+        }
+        br->acc = (br->acc << 8) | br->buf[br->pos++];
+        br->bits += 8;
+    }
+
+    br->bits -= count;
+    *value = (uint32_t)(br->acc >> br->bits) & ((count == 32) ? 0xFFFFFFFFu : ((1u << count) - 1));
+    return 1;
+}
+
+static int rice_k(const rice_state_t *rs) {
+    int k = 0;
+    while (k < CODEC_MAX_K && (rs->n << k) < rs->a) {
+        k++;
+    }
+    return k;
+}
+
+static void rice_update(rice_state_t *rs, uint32_t value) {
+    rs->a += value;
+    rs->n++;
+    if (rs->n >= CODEC_RESET_COUNT) {
+        rs->a >>= 1;
+        rs->n >>= 1;
+    }
+}
+
+static void rice_encode(bit_writer_t *bw, rice_state_t *rs, uint32_t value) {
+    int k = rice_k(rs);
+    uint32_t q = value >> k;
+
+    if (q < CODEC_RICE_LIMIT) {
+        put_bits(bw, ((1u << q) - 1) << 1, (int)q + 1);
+        if (k > 0) {
+            put_bits(bw, value, k);
+        }
+    } else {
+        put_bits(bw, (1u << CODEC_RICE_LIMIT) - 1, CODEC_RICE_LIMIT);
+        put_bits(bw, value, CODEC_ESCAPE_BITS);
+    }
+
+    rice_update(rs, value);
+}
+
+static int rice_decode(bit_reader_t *br, rice_state_t *rs, uint32_t *value) {
+    int k = rice_k(rs);
+    uint32_t q = 0;
+    uint32_t bit;
+
+    while (q < CODEC_RICE_LIMIT) {
+        if (!get_bits(br, 1, &bit)) {
+            return 0;
+        }
+        if (!bit) {
+            break;
+        }
+        q++;
+    }
+
+    if (q == CODEC_RICE_LIMIT) {
+        if (!get_bits(br, CODEC_ESCAPE_BITS, value)) {
+            return 0;
+        }
+    } else {
+        uint32_t low = 0;
+        if (k > 0 && !get_bits(br, k, &low)) {
+            return 0;
+        }
+        *value = (q << k) | low;
+    }
+
+    rice_update(rs, *value);
+    return 1;
+}
+
+static uint32_t zigzag(int32_t v) {
+    return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31);
+}
+
+static int32_t unzigzag(uint32_t v) {
+    return (int32_t)(v >> 1) ^ -(int32_t)(v & 1);
+}
+
+/* LOCO-I median edge detector over left (a), top (b) and top-left (c). */
+static int32_t predict(int32_t a, int32_t b, int32_t c) {
+    int32_t lo = a < b ? a : b;
+    int32_t hi = a < b ? b : a;
+
+    if (c >= hi) return lo;
+    if (c <= lo) return hi;
+    return a + b - c;
+}
+
+static int32_t quantize(float temp, uint16_t step_mdeg) {
+    float q = temp * 1000.0f / (float)step_mdeg;
+    if (q > (float)CODEC_Q_LIMIT) q = (float)CODEC_Q_LIMIT;
+    if (q < (float)-CODEC_Q_LIMIT) q = (float)-CODEC_Q_LIMIT;
+    return (int32_t)lroundf(q);
+}
+
+static void put_u16(uint8_t *p, uint16_t v) {
+    p[0] = (uint8_t)(v & 0xFF);
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static uint16_t get_u16(const uint8_t *p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+thermal_status_t thermal_codec_init(thermal_codec_t *codec, const thermal_codec_config_t *config, const thermal_resolution_t *resolution, int32_t *history, size_t history_len) {
+    if (!codec || !config || !resolution || !history) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    if (resolution->width == 0 || resolution->height == 0 || resolution->width > THERMAL_CODEC_MAX_WIDTH) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    if (history_len < (size_t)resolution->width * resolution->height) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    float step_mdeg = config->step * 1000.0f;
+    if (!(step_mdeg >= 1.0f && step_mdeg <= 65535.0f)) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    memset(codec, 0, sizeof(*codec));
+    codec->resolution = *resolution;
+    codec->step_mdeg = (uint16_t)lroundf(step_mdeg);
+    codec->keyframe_interval = config->keyframe_interval;
+    codec->history = history;
+
+    return THERMAL_OK;
+}
+
+size_t thermal_codec_max_encoded_size(const thermal_resolution_t *resolution) {
+    if (!resolution) {
+        return 0;
+    }
+
+    size_t pixels = (size_t)resolution->width * resolution->height;
+    return THERMAL_CODEC_HEADER_SIZE + (pixels * (CODEC_RICE_LIMIT + CODEC_ESCAPE_BITS) + 7) / 8;
+}
+
+void thermal_codec_force_keyframe(thermal_codec_t *codec) {
+    if (codec) {
+        codec->has_history = 0;
+    }
+}
+
+thermal_status_t thermal_codec_encode(thermal_codec_t *codec, const thermal_frame_t *frame, uint8_t *out, size_t out_size, size_t *out_len) {
+    if (!codec || !frame || !frame->data || !out || !out_len) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    if (frame->resolution.width != codec->resolution.width || frame->resolution.height != codec->resolution.height) {
+        return THERMAL_ERR_FRAME_INVALID;
+    }
+
+    if (out_size < THERMAL_CODEC_HEADER_SIZE) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    uint8_t keyframe = !codec->has_history ||
+                       (codec->keyframe_interval && codec->frames_since_key >= codec->keyframe_interval);
+    uint16_t width = codec->resolution.width;
+    uint16_t height = codec->resolution.height;
+
+    out[0] = THERMAL_CODEC_MAGIC;
+    out[1] = keyframe ? THERMAL_CODEC_FLAG_KEYFRAME : 0;
+    put_u16(out + 2, codec->sequence);
+    put_u16(out + 4, width);
+    put_u16(out + 6, height);
+    put_u16(out + 8, codec->step_mdeg);
+
+    bit_writer_t bw = { out, out_size, THERMAL_CODEC_HEADER_SIZE, 0, 0, 0 };
+    rice_state_t rs = { 4, 1 };
+    int32_t *history = codec->history;
+
+    /* row holds the previous row's signal; on keyframes the signal is the value, otherwise the change. */
+    for (uint16_t y = 0; y < height; y++) {
+        int32_t left = 0;
+        int32_t top_left = 0;
+
+        for (uint16_t x = 0; x < width; x++) {
+            size_t i = (size_t)y * width + x;
+            if (isnan(frame->data[i])) {
+                codec->has_history = 0;
+                return THERMAL_ERR_FRAME_INVALID;
+            }
+
+            int32_t q = quantize(frame->data[i], codec->step_mdeg);
+            int32_t signal = keyframe ? q : q - history[i];
+            int32_t pred;
+
+            if (y == 0) {
+                pred = (x == 0) ? 0 : left;
+            } else if (x == 0) {
+                pred = codec->row[0];
+            } else {
+                pred = predict(left, codec->row[x], top_left);
+            }
+
+            rice_encode(&bw, &rs, zigzag(signal - pred));
+
+            top_left = codec->row[x];
+            codec->row[x] = signal;
+            left = signal;
+            history[i] = q;
+        }
+    }
+
+    flush_bits(&bw);
+
+    if (bw.overflow) {
+        codec->has_history = 0;
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    codec->has_history = 1;
+    codec->frames_since_key = keyframe ? 1 : codec->frames_since_key + 1;
+    codec->sequence++;
+    *out_len = bw.pos;
+
+    return THERMAL_OK;
+}
+
+thermal_status_t thermal_codec_decode(thermal_codec_t *codec, const uint8_t *in, size_t in_len, thermal_frame_t *frame) {
+    if (!codec || !in || !frame || !frame->data) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    if (in_len < THERMAL_CODEC_HEADER_SIZE || in[0] != THERMAL_CODEC_MAGIC) {
+        return THERMAL_ERR_FRAME_INVALID;
+    }
+
+    uint8_t keyframe = in[1] & THERMAL_CODEC_FLAG_KEYFRAME;
+    uint16_t sequence = get_u16(in + 2);
+    uint16_t width = get_u16(in + 4);
+    uint16_t height = get_u16(in + 6);
+    uint16_t step_mdeg = get_u16(in + 8);
+
+    if (width != codec->resolution.width || height != codec->resolution.height || step_mdeg == 0) {
+        return THERMAL_ERR_FRAME_INVALID;
+    }
+
+    /* Delta frames need the immediately preceding frame; after a gap wait for the next keyframe. */
+    if (!keyframe && (!codec->has_history || sequence != codec->sequence)) {
+        return THERMAL_ERR_FRAME_INVALID;
+    }
+
+    bit_reader_t br = { in, in_len, THERMAL_CODEC_HEADER_SIZE, 0, 0 };
+    rice_state_t rs = { 4, 1 };
+    int32_t *history = codec->history;
+    float scale = (float)step_mdeg / 1000.0f;
+
+    codec->has_history = 0;
+
+    for (uint16_t y = 0; y < height; y++) {
+        int32_t left = 0;
+        int32_t top_left = 0;
+
+        for (uint16_t x = 0; x < width; x++) {
+            size_t i = (size_t)y * width + x;
+            int32_t pred;
+            uint32_t coded;
+
+            if (y == 0) {
+                pred = (x == 0) ? 0 : left;
+            } else if (x == 0) {
+                pred = codec->row[0];
+            } else {
+                pred = predict(left, codec->row[x], top_left);
+            }
+
+            if (!rice_decode(&br, &rs, &coded)) {
+                return THERMAL_ERR_FRAME_INVALID;
+            }
+
+            int32_t signal = unzigzag(coded) + pred;
+            if (signal > 2 * CODEC_Q_LIMIT || signal < -2 * CODEC_Q_LIMIT) {
+                return THERMAL_ERR_FRAME_INVALID;
+            }
+
+            int32_t q = keyframe ? signal : signal + history[i];
+            if (q > CODEC_Q_LIMIT || q < -CODEC_Q_LIMIT) {
+                return THERMAL_ERR_FRAME_INVALID;
+            }
+
+            top_left = codec->row[x];
+            codec->row[x] = signal;
+            left = signal;
+            history[i] = q;
+            frame->data[i] = (float)q * scale;
+        }
+    }
+
+    codec->has_history = 1;
+    codec->step_mdeg = step_mdeg;
+    codec->sequence = (uint16_t)(sequence + 1);
+    frame->resolution = codec->resolution;
+    frame->timestamp = sequence;
+    frame->unchanged = 0;
+
+    return THERMAL_OK;
+}
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
@@ -0,0 +1,321 @@
+#include "thermal_contour.h"
+#include <string.h>
+
+enum {
+    SIDE_TOP,
+    SIDE_RIGHT,
+    SIDE_BOTTOM,
+    SIDE_LEFT
+};
+
+/*
+ * Grid edges between neighbouring pixels are numbered horizontal first ((width - 1) per row), then vertical
+ * (width per row). A pixel's bucket is the number of levels at or below it, so "pixel above level L" is an
+ * integer compare shared by every level.
+ */
+typedef struct {
+    const float *data;
+    uint16_t width;
+    uint16_t height;
+    uint32_t horizontal_edges;
+    const uint8_t *bucket;
+    uint8_t *visited;
+    uint8_t level;
+    float value;
+    thermal_contour_set_t *out;
+} contour_ctx_t;
+
+static size_t edge_count(uint16_t width, uint16_t height) {
+    return (size_t)(width - 1) * height + (size_t)width * (height - 1);
+}
+
+size_t thermal_contour_scratch_size(const thermal_resolution_t *resolution) {
+    if (!resolution || resolution->width < 2 || resolution->height < 2) {
+        return 0;
+    }
+
+    size_t pixels = (size_t)resolution->width * resolution->height;
+    return THERMAL_ARENA_SIZE(pixels) + THERMAL_ARENA_SIZE((edge_count(resolution->width, resolution->height) + 7) / 8);
+}
+
+static uint32_t side_edge(const contour_ctx_t *ctx, uint16_t cx, uint16_t cy, int side) {
+    switch (side) {
+        case SIDE_TOP: return (uint32_t)cy * (ctx->width - 1) + cx;
+        case SIDE_BOTTOM: return (uint32_t)(cy + 1) * (ctx->width - 1) + cx;
+        case SIDE_LEFT: return ctx->horizontal_edges + (uint32_t)cy * ctx->width + cx;
+        default: return ctx->horizontal_edges + (uint32_t)cy * ctx->width + cx + 1;
+    }
+}
+
+static void edge_ends(const contour_ctx_t *ctx, uint32_t edge, uint32_t *a, uint32_t *b, uint16_t *x, uint16_t *y, uint8_t *vertical) {
+    if (edge < ctx->horizontal_edges) {
+        *y = (uint16_t)(edge / (ctx->width - 1));
+        *x = (uint16_t)(edge % (ctx->width - 1));
+        *vertical = 0;
+        *a = (uint32_t)*y * ctx->width + *x;
+        *b = *a + 1;
+    } else {
+        uint32_t v = edge - ctx->horizontal_edges;
+        *y = (uint16_t)(v / ctx->width);
+        *x = (uint16_t)(v % ctx->width);
+        *vertical = 1;
+        *a = (uint32_t)*y * ctx->width + *x;
+        *b = *a + ctx->width;
+    }
+}
+
+static int above(const contour_ctx_t *ctx, uint32_t pixel) {
+    return ctx->bucket[pixel] > ctx->level;
+}
+
+static int crossed(const contour_ctx_t *ctx, uint32_t edge) {
+    uint32_t a, b;
+    uint16_t x, y;
+    uint8_t vertical;
+    edge_ends(ctx, edge, &a, &b, &x, &y, &vertical);
+    return above(ctx, a) != above(ctx, b);
+}
+
+static int visited(const contour_ctx_t *ctx, uint32_t edge) {
+    return (ctx->visited[edge / 8] >> (edge % 8)) & 1;
+}
+
+static void mark_visited(contour_ctx_t *ctx, uint32_t edge) {
+    ctx->visited[edge / 8] |= (uint8_t)(1u << (edge % 8));
+}
+
+static int append_point(contour_ctx_t *ctx, uint32_t edge) {
+    thermal_contour_set_t *out = ctx->out;
+    if (out->point_count >= out->point_capacity) {
+        out->truncated = 1;
+        return 0;
+    }
+
+    uint32_t a, b;
+    uint16_t x, y;
+    uint8_t vertical;
+    edge_ends(ctx, edge, &a, &b, &x, &y, &vertical);
+
+    /* Linear interpolation along the edge; the endpoints straddle the level, so the divisor is never zero. */
+    float va = ctx->data[a];
+    float vb = ctx->data[b];
+    float t = (ctx->value - va) / (vb - va);
+
+    thermal_point_t *point = &out->points[out->point_count++];
+    point->x = (float)x + (vertical ? 0.0f : t);
+    point->y = (float)y + (vertical ? t : 0.0f);
+    return 1;
+}
+
+/* Exit side for a contour entering the cell through entry; saddles are split by the cell-centre average. */
+static int exit_side(const contour_ctx_t *ctx, uint16_t cx, uint16_t cy, int entry) {
+    int sides[4];
+    int count = 0;
+
+    for (int side = SIDE_TOP; side <= SIDE_LEFT; side++) {
+        if (side != entry && crossed(ctx, side_edge(ctx, cx, cy, side))) {
+            sides[count++] = side;
+        }
+    }
+
+    if (count == 1) {
+        return sides[0];
+    }
+
+    uint32_t tl = (uint32_t)cy * ctx->width + cx;
+    float centre = (ctx->data[tl] + ctx->data[tl + 1] + ctx->data[tl + ctx->width] + ctx->data[tl + ctx->width + 1]) * 0.25f;
+    int cut_tl_br = above(ctx, tl) != (centre >= ctx->value);
+
+    /* Cutting the top-left and bottom-right corners pairs top with left and right with bottom. */
+    if (cut_tl_br) {
+        switch (entry) {
+            case SIDE_TOP: return SIDE_LEFT;
+            case SIDE_LEFT: return SIDE_TOP;
+            case SIDE_RIGHT: return SIDE_BOTTOM;
+            default: return SIDE_RIGHT;
+        }
+    }
+
+    switch (entry) {
+        case SIDE_TOP: return SIDE_RIGHT;
+        case SIDE_RIGHT: return SIDE_TOP;
+        case SIDE_LEFT: return SIDE_BOTTOM;
+        default: return SIDE_LEFT;
+    }
+}
+
+/* Steps into the cell across side, returning 0 at the grid boundary. */
+static int cross_side(const contour_ctx_t *ctx, uint16_t *cx, uint16_t *cy, int side, int *entry) {
+    switch (side) {
+        case SIDE_TOP:
+            if (*cy == 0) return 0;
+            (*cy)--;
+            *entry = SIDE_BOTTOM;
+            return 1;
+        case SIDE_BOTTOM:
+            if (*cy + 2 >= ctx->height) return 0;
+            (*cy)++;
+            *entry = SIDE_TOP;
+            return 1;
+        case SIDE_LEFT:
+            if (*cx == 0) return 0;
+            (*cx)--;
+            *entry = SIDE_RIGHT;
+            return 1;
+        default:
+            if (*cx + 2 >= ctx->width) return 0;
+            (*cx)++;
+            *entry = SIDE_LEFT;
+            return 1;
+    }
+}
+
+/* Traces one contour from an unvisited crossed edge; returns 0 once the output is full. */
+static int trace(contour_ctx_t *ctx, uint32_t start) {
+    thermal_contour_set_t *out = ctx->out;
+    if (out->line_count >= out->line_capacity) {
+        out->truncated = 1;
+        return 0;
+    }
+
+    uint32_t a, b;
+    uint16_t x, y;
+    uint8_t vertical;
+    edge_ends(ctx, start, &a, &b, &x, &y, &vertical);
+
+    /* Enter the cell below or right of the edge when it exists, else the one above or left. */
+    uint16_t cx = x;
+    uint16_t cy = y;
+    int entry;
+    if (vertical) {
+        if (x + 1 < ctx->width) {
+            entry = SIDE_LEFT;
+        } else {
+            cx = (uint16_t)(x - 1);
+            entry = SIDE_RIGHT;
+        }
+    } else {
+        if (y + 1 < ctx->height) {
+            entry = SIDE_TOP;
+        } else {
+            cy = (uint16_t)(y - 1);
+            entry = SIDE_BOTTOM;
+        }
+    }
+
+    size_t first = out->point_count;
+    uint8_t closed = 0;
+    int ok = append_point(ctx, start);
+    mark_visited(ctx, start);
+
+    while (ok) {
+        int side = exit_side(ctx, cx, cy, entry);
+        uint32_t edge = side_edge(ctx, cx, cy, side);
+
+        if (visited(ctx, edge)) {
+            closed = (edge == start);
+            ok = closed ? append_point(ctx, edge) : 1;
+            break;
+        }
+
+        ok = append_point(ctx, edge);
+        mark_visited(ctx, edge);
+        if (!ok || !cross_side(ctx, &cx, &cy, side, &entry)) {
+            break;
+        }
+    }
+
+    size_t count = out->point_count - first;
+    if (count < 2) {
+        out->point_count = first;
+        return ok;
+    }
+
+    thermal_polyline_t *line = &out->lines[out->line_count++];
+    line->first = (uint32_t)first;
+    line->count = (uint16_t)count;
+    line->level = ctx->level;
+    line->closed = closed;
+    return ok;
+}
+
+static int is_boundary(const contour_ctx_t *ctx, uint32_t edge) {
+    uint32_t a, b;
+    uint16_t x, y;
+    uint8_t vertical;
+    edge_ends(ctx, edge, &a, &b, &x, &y, &vertical);
+    return vertical ? (x == 0 || x + 1 == ctx->width) : (y == 0 || y + 1 == ctx->height);
+}
+
+thermal_status_t thermal_contour_extract(const thermal_frame_t *frame, const float *levels, uint8_t level_count, thermal_contour_set_t *contours, thermal_arena_t *scratch) {
+    if (!frame || !frame->data || !levels || !contours || !contours->points || !contours->lines) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    if (level_count == 0 || level_count > THERMAL_CONTOUR_MAX_LEVELS) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    for (uint8_t i = 1; i < level_count; i++) {
+        if (!(levels[i] > levels[i - 1])) {
+            return THERMAL_ERR_INVALID_ARG;
+        }
+    }
+
+    uint16_t width = frame->resolution.width;
+    uint16_t height = frame->resolution.height;
+    if (width < 2 || height < 2) {
+        return THERMAL_ERR_FRAME_INVALID;
+    }
+
+    contours->point_count = 0;
+    contours->line_count = 0;
+    contours->truncated = 0;
+
+    size_t pixels = (size_t)width * height;
+    size_t edges = edge_count(width, height);
+    size_t mark = thermal_arena_mark(scratch);
+    uint8_t *bucket = thermal_arena_alloc(scratch, pixels);
+    uint8_t *visited_bits = thermal_arena_alloc(scratch, (edges + 7) / 8);
+    if (!bucket || !visited_bits) {
+        thermal_arena_release(scratch, mark);
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    /* The single pass over the frame: every level's inside/outside test comes from these buckets. */
+    for (size_t i = 0; i < pixels; i++) {
+        float v = frame->data[i];
+        uint8_t n = 0;
+        while (n < level_count && v >= levels[n]) {
+            n++;
+        }
+        bucket[i] = n;
+    }
+
+    contour_ctx_t ctx = { frame->data, width, height, (uint32_t)(width - 1) * height, bucket, visited_bits, 0, 0.0f, contours };
+    int ok = 1;
+
+    for (uint8_t level = 0; level < level_count && ok; level++) {
+        ctx.level = level;
+        ctx.value = levels[level];
+        memset(visited_bits, 0, (edges + 7) / 8);
+
+        /* Open contours start on the border so they are traced end to end; what is left forms closed loops. */
+        for (int pass = 0; pass < 2 && ok; pass++) {
+            for (uint32_t edge = 0; edge < edges && ok; edge++) {
+                if (visited(&ctx, edge) || is_boundary(&ctx, edge) != (pass == 0) || !crossed(&ctx, edge)) {
+                    continue;
+                }
+                ok = trace(&ctx, edge);
+            }
+        }
+    }
+
+    thermal_arena_release(scratch, mark);
+    return THERMAL_OK;
+}
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
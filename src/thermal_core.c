@@ -1,60 +1,61 @@
 #include "thermal_core.h"
-#include <stdio.h>
+#include "thermal_log.h"
+#include "thermal_trace.h"
 #include <string.h>
 
-thermal_status_t thermal_init(thermal_device_t *device, thermal_transport_t *transport, const sensor_ops_t *sensor_ops, uint8_t dev_addr) {
-    printf("thermal_init: device=%p, transport=%p, sensor_ops=%p, dev_addr=%u\n", 
+thermal_status_t thermal_init(thermal_device_t *device, thermal_transport_t *transport, const sensor_ops_t *sensor_ops, uint8_t dev_addr, thermal_arena_t *scratch) {
+    THERMAL_LOG_DEBUG("thermal_init: device=%p, transport=%p, sensor_ops=%p, dev_addr=%u\n", 
            (void*)device, (void*)transport, (const void*)sensor_ops, dev_addr);
-    fflush(stdout);
     
     if (!device || !transport || !sensor_ops) {
         return THERMAL_ERR_INVALID_ARG;
     }
     
-    printf("thermal_init: checking sensor ops...\n");
-    fflush(stdout);
+    THERMAL_LOG_DEBUG("thermal_init: checking sensor ops...\n");
     
     if (!sensor_ops->init || !sensor_ops->get_frame || !sensor_ops->get_resolution) {
-        printf("Thermal: sensor operations incomplete\n");
+        THERMAL_LOG_ERROR("Thermal: sensor operations incomplete\n");
         return THERMAL_ERR_INVALID_ARG;
     }
     
-    printf("thermal_init: setting up device structure...\n");
-    fflush(stdout);
+    if (sensor_ops->scratch_size && !scratch) {
+        THERMAL_LOG_ERROR("Thermal: %s needs a scratch arena\n", sensor_ops->name);
+        return THERMAL_ERR_INVALID_ARG;
+    }
+    
+    THERMAL_LOG_DEBUG("thermal_init: setting up device structure...\n");
     
     device->transport = transport;
     device->sensor_ops = sensor_ops;
     device->device_addr = dev_addr;
+    device->refresh_rate_hz = 0;
+    device->frame_counter = 0;
+    device->change_detector = NULL;
+    device->scratch = scratch;
     device->initialized = 0;
     
-    printf("thermal_init: calling sensor init...\n");
-    fflush(stdout);
-    thermal_status_t status = sensor_ops->init(transport, dev_addr);
-    printf("thermal_init: sensor init returned %d\n", status);
-    fflush(stdout);
+    THERMAL_LOG_DEBUG("thermal_init: calling sensor init...\n");
+    thermal_status_t status = sensor_ops->init(transport, dev_addr, scratch);
+    THERMAL_LOG_DEBUG("thermal_init: sensor init returned %d\n", status);
     if (status != THERMAL_OK) {
-        printf("Thermal: sensor initialization failed\n");
+        THERMAL_LOG_ERROR("Thermal: sensor initialization failed\n");
         return status;
     }
     
-    printf("thermal_init: getting resolution...\n");
-    fflush(stdout);
+    THERMAL_LOG_DEBUG("thermal_init: getting resolution...\n");
     status = sensor_ops->get_resolution(&device->resolution);
-    printf("thermal_init: get_resolution returned %d\n", status);
-    fflush(stdout);
+    THERMAL_LOG_DEBUG("thermal_init: get_resolution returned %d\n", status);
     if (status != THERMAL_OK) {
-        printf("Thermal: failed to get resolution\n");
+        THERMAL_LOG_ERROR("Thermal: failed to get resolution\n");
         return status;
     }
     
-    printf("thermal_init: marking device as initialized...\n");
-    fflush(stdout);
+    THERMAL_LOG_DEBUG("thermal_init: marking device as initialized...\n");
     device->initialized = 1;
-    printf("Thermal: device initialized - %s (%ux%u)\n", 
+    THERMAL_LOG_INFO("Thermal: device initialized - %s (%ux%u)\n", 
            sensor_ops->name, device->resolution.width, device->resolution.height);
     
-    printf("thermal_init: complete, returning...\n");
-    fflush(stdout);
+    THERMAL_LOG_DEBUG("thermal_init: complete, returning...\n");
     return THERMAL_OK;
 }
 
@@ -64,33 +65,48 @@ thermal_status_t thermal_get_frame(thermal_device_t *device, thermal_frame_t *fr
     }
     
     if (!device->initialized) {
-        printf("Thermal: device not initialized\n");
+        THERMAL_LOG_ERROR("Thermal: device not initialized\n");
         return THERMAL_ERR_NOT_INIT;
     }
     
     size_t expected_size = device->resolution.width * device->resolution.height;
     
+    THERMAL_TRACE_FRAME(device->frame_counter);
+    THERMAL_TRACE_BEGIN(THERMAL_STAGE_FRAME);
+    
     thermal_status_t status = device->sensor_ops->get_frame(
         device->transport, 
         device->device_addr, 
         frame->data, 
-        expected_size
+        expected_size,
+        device->scratch
     );
     
     if (status != THERMAL_OK) {
-        printf("Thermal: frame acquisition failed\n");
+        THERMAL_LOG_ERROR("Thermal: frame acquisition failed\n");
         return status;
     }
     
     frame->resolution.width = device->resolution.width;
     frame->resolution.height = device->resolution.height;
+    frame->timestamp = device->frame_counter++;
+    frame->unchanged = 0;
     
-    static uint32_t frame_counter = 0;
-    frame->timestamp = frame_counter++;
+    if (device->change_detector) {
+        uint8_t changed;
+        if (thermal_change_check(device->change_detector, frame, &changed) == THERMAL_OK) {
+            frame->unchanged = !changed;
+        }
+    }
     
+    THERMAL_TRACE_END(THERMAL_STAGE_FRAME);
     return THERMAL_OK;
 }
 
+size_t thermal_sensor_scratch_size(const sensor_ops_t *sensor_ops) {
+    return sensor_ops ? sensor_ops->scratch_size : 0;
+}
+
 thermal_status_t thermal_get_resolution(thermal_device_t *device, thermal_resolution_t *resolution) {
     if (!device || !resolution) {
         return THERMAL_ERR_INVALID_ARG;
@@ -119,7 +135,68 @@ thermal_status_t thermal_set_refresh_rate(thermal_device_t *device, uint8_t rate
         return THERMAL_ERR_UNSUPPORTED;
     }
     
-    return device->sensor_ops->set_refresh_rate(device->transport, device->device_addr, rate_hz);
+    thermal_status_t status = device->sensor_ops->set_refresh_rate(device->transport, device->device_addr, rate_hz);
+    if (status == THERMAL_OK) {
+        device->refresh_rate_hz = rate_hz;
+    }
+    
+    return status;
+}
+
+thermal_status_t thermal_get_refresh_rates(thermal_device_t *device, const uint8_t **rates, uint8_t *count) {
+    if (!device || !rates || !count) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+    
+    if (!device->initialized) {
+        return THERMAL_ERR_NOT_INIT;
+    }
+    
+    if (!device->sensor_ops->refresh_rates || device->sensor_ops->refresh_rate_count == 0) {
+        return THERMAL_ERR_UNSUPPORTED;
+    }
+    
+    *rates = device->sensor_ops->refresh_rates;
+    *count = device->sensor_ops->refresh_rate_count;
+    
+    return THERMAL_OK;
+}
+
+thermal_status_t thermal_set_bad_pixels(thermal_device_t *device, const uint16_t *indices, uint8_t count) {
+    if (!device || (count && !indices)) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+    
+    if (!device->initialized) {
+        return THERMAL_ERR_NOT_INIT;
+    }
+    
+    if (!device->sensor_ops->set_bad_pixels) {
+        return THERMAL_ERR_UNSUPPORTED;
+    }
+    
+    return device->sensor_ops->set_bad_pixels(indices, count);
+}
+
+thermal_status_t thermal_set_change_detector(thermal_device_t *device, thermal_change_detector_t *detector) {
+    if (!device) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+    
+    if (!device->initialized) {
+        return THERMAL_ERR_NOT_INIT;
+    }
+    
+    if (detector && detector->reference_len < (size_t)device->resolution.width * device->resolution.height) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+    
+    if (detector) {
+        thermal_change_reset(detector);
+    }
+    
+    device->change_detector = detector;
+    return THERMAL_OK;
 }
 
 thermal_status_t thermal_self_test(thermal_device_t *device) {
@@ -132,7 +209,7 @@ thermal_status_t thermal_self_test(thermal_device_t *device) {
     }
     
     if (!device->sensor_ops->self_test) {
-        printf("Thermal: self-test not supported\n");
+        THERMAL_LOG_WARN("Thermal: self-test not supported\n");
         return THERMAL_ERR_UNSUPPORTED;
     }
     
@@ -155,7 +232,7 @@ thermal_status_t thermal_shutdown(thermal_device_t *device) {
     }
     
     device->initialized = 0;
-    printf("Thermal: device shutdown\n");
+    THERMAL_LOG_INFO("Thermal: device shutdown\n");
     
     return status;
 }
@@ -0,0 +1,149 @@
+#include "thermal_governor.h"
+#include "thermal_log.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+thermal_status_t thermal_governor_init(thermal_governor_t *gov, thermal_device_t *device, const thermal_governor_config_t *config, float *reference, size_t reference_len) {
+    if (!gov || !device || !config || !reference) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    if (config->min_rate_hz > config->max_rate_hz || config->lower_threshold > config->raise_threshold) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    const uint8_t *rates;
+    uint8_t count;
+    thermal_status_t status = thermal_get_refresh_rates(device, &rates, &count);
+    if (status != THERMAL_OK) {
+        return status;
+    }
+
+    if (reference_len < (size_t)device->resolution.width * device->resolution.height) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    int level_min = -1;
+    int level_max = -1;
+    for (uint8_t i = 0; i < count; i++) {
+        if (rates[i] >= config->min_rate_hz && rates[i] <= config->max_rate_hz) {
+            if (level_min < 0) {
+                level_min = i;
+            }
+            level_max = i;
+        }
+    }
+
+    if (level_min < 0) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    memset(gov, 0, sizeof(*gov));
+    gov->device = device;
+    gov->config = *config;
+    gov->rates = rates;
+    gov->level_min = (uint8_t)level_min;
+    gov->level_max = (uint8_t)level_max;
+    gov->level = (uint8_t)level_max;
+    gov->reference = reference;
+
+    for (int i = level_min; i <= level_max; i++) {
+        if (rates[i] == device->refresh_rate_hz) {
+            gov->level = (uint8_t)i;
+            return THERMAL_OK;
+        }
+    }
+
+    return thermal_set_refresh_rate(device, rates[gov->level]);
+}
+
+thermal_status_t thermal_governor_update(thermal_governor_t *gov, const thermal_frame_t *frame, uint8_t *rate_changed) {
+    if (!gov || !frame || !frame->data) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    if (rate_changed) {
+        *rate_changed = 0;
+    }
+
+    uint16_t width = gov->device->resolution.width;
+    uint16_t height = gov->device->resolution.height;
+    if (frame->resolution.width != width || frame->resolution.height != height) {
+        return THERMAL_ERR_FRAME_INVALID;
+    }
+
+    size_t total_pixels = (size_t)width * height;
+    float *reference = gov->reference;
+    float sum = 0.0f;
+    float max_temp = frame->data[0];
+    size_t max_index = 0;
+
+    for (size_t i = 0; i < total_pixels; i++) {
+        float temp = frame->data[i];
+        sum += fabsf(temp - reference[i]);
+        reference[i] = temp;
+        if (temp > max_temp) {
+            max_temp = temp;
+            max_index = i;
+        }
+    }
+
+    uint16_t hot_x = (uint16_t)(max_index % width);
+    uint16_t hot_y = (uint16_t)(max_index / width);
+    int dx = abs((int)hot_x - (int)gov->hot_x);
+    int dy = abs((int)hot_y - (int)gov->hot_y);
+    gov->hot_x = hot_x;
+    gov->hot_y = hot_y;
+
+    if (!gov->has_reference) {
+        gov->has_reference = 1;
+        return THERMAL_OK;
+    }
+
+    gov->activity = sum / (float)total_pixels;
+    uint8_t moved = gov->config.motion_pixels && (dx >= gov->config.motion_pixels || dy >= gov->config.motion_pixels);
+    uint8_t target = gov->level;
+
+    /* Busy scenes jump straight to the top rate; quiet ones step down one rate at a time. */
+    if (gov->activity >= gov->config.raise_threshold || moved) {
+        gov->quiet_frames = 0;
+        target = gov->level_max;
+    } else if (gov->activity <= gov->config.lower_threshold) {
+        if (++gov->quiet_frames >= gov->config.lower_frames) {
+            gov->quiet_frames = 0;
+            if (gov->level > gov->level_min) {
+                target = gov->level - 1;
+            }
+        }
+    } else {
+        gov->quiet_frames = 0;
+    }
+
+    if (target == gov->level) {
+        return THERMAL_OK;
+    }
+
+    thermal_status_t status = thermal_set_refresh_rate(gov->device, gov->rates[target]);
+    if (status != THERMAL_OK) {
+        return status;
+    }
+
+    THERMAL_LOG_DEBUG("Governor: %u Hz -> %u Hz\n", gov->rates[gov->level], gov->rates[target]);
+    gov->level = target;
+    gov->rate_changes++;
+    if (rate_changed) {
+        *rate_changed = 1;
+    }
+
+    return THERMAL_OK;
+}
+
+uint8_t thermal_governor_rate(const thermal_governor_t *gov) {
+    return gov ? gov->rates[gov->level] : 0;
+}
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
@@ -0,0 +1,231 @@
+#include "thermal_incremental.h"
+#include "thermal_processing.h"
+#include <math.h>
+#include <string.h>
+
+#define TILE_FIRST_COL 0x02
+#define TILE_FIRST_ROW 0x04
+
+/* Same index computation as thermal_interpolate_bilinear, so tile edges match its taps exactly. */
+static void build_edges(uint16_t *edges, uint8_t tiles, uint8_t tile_size, uint16_t src_len, uint16_t dst_len) {
+    float ratio = (float)(src_len - 1) / (float)(dst_len - 1);
+    uint8_t tile = 0;
+
+    edges[0] = 0;
+    for (uint16_t d = 0; d < dst_len; d++) {
+        uint16_t s = (uint16_t)(d * ratio);
+        while (tile < tiles - 1 && s >= (tile + 1) * tile_size) {
+            edges[++tile] = d;
+        }
+    }
+
+    while (tile < tiles) {
+        edges[++tile] = dst_len;
+    }
+}
+
+thermal_status_t thermal_incremental_init(thermal_incremental_t *inc, const thermal_resolution_t *src_res, const thermal_resolution_t *dst_res, float tolerance, float *reference, float *upscaled, rgb565_t *image) {
+    if (!inc || !src_res || !dst_res || !reference || !upscaled || !image || !(tolerance >= 0.0f)) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    if (src_res->width < 2 || src_res->height < 2 || dst_res->width < 2 || dst_res->height < 2) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    uint32_t tile_size = 4;
+    uint32_t tiles_x, tiles_y;
+    for (;;) {
+        tiles_x = (src_res->width + tile_size - 1) / tile_size;
+        tiles_y = (src_res->height + tile_size - 1) / tile_size;
+        if (tiles_x * tiles_y <= THERMAL_INCREMENTAL_MAX_TILES) {
+            break;
+        }
+        tile_size *= 2;
+    }
+
+    if (tile_size > UINT8_MAX) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    memset(inc, 0, sizeof(*inc));
+    inc->src_res = *src_res;
+    inc->dst_res = *dst_res;
+    inc->tolerance = tolerance;
+    inc->reference = reference;
+    inc->upscaled = upscaled;
+    inc->image = image;
+    inc->tile_size = (uint8_t)tile_size;
+    inc->tiles_x = (uint8_t)tiles_x;
+    inc->tiles_y = (uint8_t)tiles_y;
+
+    build_edges(inc->dst_col, inc->tiles_x, inc->tile_size, src_res->width, dst_res->width);
+    build_edges(inc->dst_row, inc->tiles_y, inc->tile_size, src_res->height, dst_res->height);
+
+    return THERMAL_OK;
+}
+
+void thermal_incremental_invalidate(thermal_incremental_t *inc) {
+    if (inc) {
+        inc->valid = 0;
+    }
+}
+
+/* Pixels that moved past tolerance are copied into the reference; flags note whether the tile's first column/row was among them. */
+static uint8_t check_tile(thermal_incremental_t *inc, const float *data, uint8_t tx, uint8_t ty) {
+    uint16_t width = inc->src_res.width;
+    uint16_t x0 = (uint16_t)(tx * inc->tile_size);
+    uint16_t y0 = (uint16_t)(ty * inc->tile_size);
+    uint16_t x1 = (x0 + inc->tile_size < width) ? x0 + inc->tile_size : width;
+    uint16_t y1 = (y0 + inc->tile_size < inc->src_res.height) ? y0 + inc->tile_size : inc->src_res.height;
+    uint8_t flags = 0;
+
+    for (uint16_t y = y0; y < y1; y++) {
+        const float *row = data + (size_t)y * width;
+        float *ref = inc->reference + (size_t)y * width;
+
+        for (uint16_t x = x0; x < x1; x++) {
+            if (fabsf(row[x] - ref[x]) > inc->tolerance) {
+                ref[x] = row[x];
+                flags |= 1;
+                if (x == x0) flags |= TILE_FIRST_COL;
+                if (y == y0) flags |= TILE_FIRST_ROW;
+            }
+        }
+    }
+
+    return flags;
+}
+
+static void mark_dirty(thermal_incremental_t *inc, const float *data) {
+    uint8_t tiles_x = inc->tiles_x;
+
+    memset(inc->dirty, 0, sizeof(inc->dirty));
+
+    /* A display tile also reads the first column/row of its right and lower neighbours (bilinear halo). */
+    for (uint8_t ty = 0; ty < inc->tiles_y; ty++) {
+        for (uint8_t tx = 0; tx < tiles_x; tx++) {
+            uint8_t flags = check_tile(inc, data, tx, ty);
+            if (!flags) {
+                continue;
+            }
+
+            inc->dirty[ty * tiles_x + tx] = 1;
+            if (tx > 0 && (flags & TILE_FIRST_COL)) {
+                inc->dirty[ty * tiles_x + tx - 1] = 1;
+            }
+            if (ty > 0 && (flags & TILE_FIRST_ROW)) {
+                inc->dirty[(ty - 1) * tiles_x + tx] = 1;
+            }
+            if (tx > 0 && ty > 0 && (flags & TILE_FIRST_COL) && (flags & TILE_FIRST_ROW)) {
+                inc->dirty[(ty - 1) * tiles_x + tx - 1] = 1;
+            }
+        }
+    }
+}
+
+/* Joins dirty tiles into horizontal runs, then stacks runs with identical spans across tile rows. */
+static void build_rects(thermal_incremental_t *inc) {
+    inc->rect_count = 0;
+
+    for (uint8_t ty = 0; ty < inc->tiles_y; ty++) {
+        uint16_t y = inc->dst_row[ty];
+        uint16_t height = (uint16_t)(inc->dst_row[ty + 1] - y);
+
+        if (height == 0) {
+            continue;
+        }
+
+        for (uint8_t tx = 0; tx < inc->tiles_x; ) {
+            if (!inc->dirty[ty * inc->tiles_x + tx]) {
+                tx++;
+                continue;
+            }
+
+            uint8_t end = tx;
+            while (end < inc->tiles_x && inc->dirty[ty * inc->tiles_x + end]) {
+                end++;
+            }
+
+            uint16_t x = inc->dst_col[tx];
+            uint16_t width = (uint16_t)(inc->dst_col[end] - x);
+            tx = end;
+
+            if (width == 0) {
+                continue;
+            }
+
+            uint8_t merged = 0;
+            for (uint16_t i = 0; i < inc->rect_count; i++) {
+                thermal_rect_t *r = &inc->rects[i];
+                if (r->x == x && r->width == width && r->y + r->height == y) {
+                    r->height += height;
+                    merged = 1;
+                    break;
+                }
+            }
+
+            if (!merged) {
+                thermal_rect_t *r = &inc->rects[inc->rect_count++];
+                r->x = x;
+                r->y = y;
+                r->width = width;
+                r->height = height;
+            }
+        }
+    }
+}
+
+thermal_status_t thermal_incremental_render(thermal_incremental_t *inc, const thermal_frame_t *frame, float min_temp, float max_temp, const thermal_rect_t **rects, uint16_t *rect_count) {
+    if (!inc || !frame || !frame->data || !rects || !rect_count) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    if (frame->resolution.width != inc->src_res.width || frame->resolution.height != inc->src_res.height) {
+        return THERMAL_ERR_FRAME_INVALID;
+    }
+
+    if (min_temp >= max_temp) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    *rects = inc->rects;
+
+    /* A new colour range repaints everything. */
+    if (!inc->valid || min_temp != inc->min_temp || max_temp != inc->max_temp) {
+        memcpy(inc->reference, frame->data, (size_t)inc->src_res.width * inc->src_res.height * sizeof(float));
+        inc->rects[0].x = 0;
+        inc->rects[0].y = 0;
+        inc->rects[0].width = inc->dst_res.width;
+        inc->rects[0].height = inc->dst_res.height;
+        inc->rect_count = 1;
+    } else if (frame->unchanged) {
+        inc->rect_count = 0;
+    } else {
+        mark_dirty(inc, frame->data);
+        build_rects(inc);
+    }
+
+    for (uint16_t i = 0; i < inc->rect_count; i++) {
+        thermal_status_t status = thermal_interpolate_bilinear_region(inc->reference, &inc->src_res, inc->upscaled, &inc->dst_res, &inc->rects[i]);
+        if (status == THERMAL_OK) {
+            status = thermal_apply_colormap_region(inc->upscaled, &inc->dst_res, min_temp, max_temp, inc->image, &inc->rects[i]);
+        }
+        if (status != THERMAL_OK) {
+            inc->valid = 0;
+            return status;
+        }
+    }
+
+    inc->valid = 1;
+    inc->min_temp = min_temp;
+    inc->max_temp = max_temp;
+    *rect_count = inc->rect_count;
+
+    return THERMAL_OK;
+}
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
@@ -0,0 +1,274 @@
+#include "thermal_log.h"
+#include "platform/platform_hal.h"
+#include <stdio.h>
+#include <string.h>
+
+#define LOG_RING_MASK (THERMAL_LOG_RING_SIZE - 1)
+#define LOG_SPEC_MAX 24
+
+typedef struct {
+    platform_atomic_u32_t sequence;
+    thermal_log_record_t record;
+} log_slot_t;
+
+static log_slot_t log_ring[THERMAL_LOG_RING_SIZE];
+static platform_atomic_u32_t log_enqueue_pos;
+static platform_atomic_u32_t log_dequeue_pos;
+static platform_atomic_u32_t log_dropped;
+static platform_atomic_u32_t log_ready;
+static thermal_log_sink_fn log_sink = NULL;
+
+static void log_ring_init(void) {
+    uint32_t expected = 0;
+    if (!platform_atomic_cas(&log_ready, &expected, 1)) {
+        while (platform_atomic_load(&log_ready) != 2) {
+        }
+        return;
+    }
+
+    for (uint32_t i = 0; i < THERMAL_LOG_RING_SIZE; i++) {
+        atomic_store_explicit(&log_ring[i].sequence, i, memory_order_relaxed);
+    }
+    platform_atomic_store(&log_ready, 2);
+}
+
+void thermal_log_write(uint8_t level, const char *fmt, uint8_t arg_count, const thermal_log_arg_t *args) {
+    if (!fmt) {
+        return;
+    }
+
+    if (platform_atomic_load(&log_ready) != 2) {
+        log_ring_init();
+    }
+
+    if (arg_count > THERMAL_LOG_MAX_ARGS) {
+        arg_count = THERMAL_LOG_MAX_ARGS;
+    }
+
+    uint32_t pos = atomic_load_explicit(&log_enqueue_pos, memory_order_relaxed);
+    log_slot_t *slot;
+
+    for (;;) {
+        slot = &log_ring[pos & LOG_RING_MASK];
+        uint32_t seq = platform_atomic_load(&slot->sequence);
+        int32_t diff = (int32_t)(seq - pos);
+
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&log_enqueue_pos, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            platform_atomic_fetch_add(&log_dropped, 1);
+            return;
+        } else {
+            pos = atomic_load_explicit(&log_enqueue_pos, memory_order_relaxed);
+        }
+    }
+
+    slot->record.fmt = fmt;
+    slot->record.timestamp_us = platform_time_us();
+    slot->record.level = level;
+    slot->record.arg_count = arg_count;
+    for (uint8_t i = 0; i < arg_count; i++) {
+        slot->record.args[i] = args[i];
+    }
+
+    platform_atomic_store(&slot->sequence, pos + 1);
+}
+
+static int log_pop(thermal_log_record_t *record) {
+    uint32_t pos = atomic_load_explicit(&log_dequeue_pos, memory_order_relaxed);
+    log_slot_t *slot = &log_ring[pos & LOG_RING_MASK];
+    uint32_t seq = platform_atomic_load(&slot->sequence);
+
+    if ((int32_t)(seq - (pos + 1)) < 0) {
+        return 0;
+    }
+
+    *record = slot->record;
+    atomic_store_explicit(&log_dequeue_pos, pos + 1, memory_order_relaxed);
+    platform_atomic_store(&slot->sequence, pos + THERMAL_LOG_RING_SIZE);
+    return 1;
+}
+
+static uint64_t arg_as_integer(const thermal_log_arg_t *arg) {
+    switch (arg->type) {
+        case THERMAL_LOG_ARG_DOUBLE: return (uint64_t)(long long)arg->value.d;
+        case THERMAL_LOG_ARG_STR:
+        case THERMAL_LOG_ARG_PTR: return (uint64_t)(uintptr_t)arg->value.p;
+        default: return arg->value.u;
+    }
+}
+
+static double arg_as_double(const thermal_log_arg_t *arg) {
+    switch (arg->type) {
+        case THERMAL_LOG_ARG_DOUBLE: return arg->value.d;
+        case THERMAL_LOG_ARG_INT: return (double)(int64_t)arg->value.u;
+        case THERMAL_LOG_ARG_UINT: return (double)arg->value.u;
+        default: return 0.0;
+    }
+}
+
+/*
+ * A '*' width or precision is replaced by the value recorded for it, so snprintf never reads an argument that
+ * was not passed. A negative precision means none, as in printf; a '*' with no recorded value is dropped.
+ */
+static size_t format_arg(char *out, size_t out_size, const char *spec, size_t spec_len, char conv, const thermal_log_arg_t *arg,
+                         const int *stars, uint8_t star_count) {
+    char local_spec[LOG_SPEC_MAX];
+    size_t n = 0;
+    uint8_t star = 0;
+    int written;
+
+    for (size_t i = 0; i < spec_len && n < LOG_SPEC_MAX - 4; i++) {
+        char c = spec[i];
+        if (c == 'h' || c == 'l' || c == 'z' || c == 'j' || c == 't' || c == 'L') {
+            continue;
+        }
+
+        if (c == '*') {
+            int is_precision = n > 0 && local_spec[n - 1] == '.';
+            int value = (star < star_count) ? stars[star] : -1;
+            int valid = star < star_count && !(is_precision && value < 0);
+            star++;
+
+            if (!valid) {
+                n -= is_precision;
+                continue;
+            }
+
+            int digits = snprintf(local_spec + n, LOG_SPEC_MAX - 4 - n, "%d", value);
+            if (digits < 0 || (size_t)digits >= LOG_SPEC_MAX - 4 - n) {
+                return 0;
+            }
+            n += (size_t)digits;
+            continue;
+        }
+
+        local_spec[n++] = c;
+    }
+
+    switch (conv) {
+        case 'd': case 'i':
+            local_spec[n++] = 'l'; local_spec[n++] = 'l'; local_spec[n++] = conv; local_spec[n] = '\0';
+            written = snprintf(out, out_size, local_spec, (long long)arg_as_integer(arg));
+            break;
+        case 'u': case 'x': case 'X': case 'o':
+            local_spec[n++] = 'l'; local_spec[n++] = 'l'; local_spec[n++] = conv; local_spec[n] = '\0';
+            written = snprintf(out, out_size, local_spec, (unsigned long long)arg_as_integer(arg));
+            break;
+        case 'c':
+            local_spec[n++] = conv; local_spec[n] = '\0';
+            written = snprintf(out, out_size, local_spec, (int)arg_as_integer(arg));
+            break;
+        case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+            local_spec[n++] = conv; local_spec[n] = '\0';
+            written = snprintf(out, out_size, local_spec, arg_as_double(arg));
+            break;
+        case 's':
+            local_spec[n++] = conv; local_spec[n] = '\0';
+            written = snprintf(out, out_size, local_spec,
+                               (arg->type == THERMAL_LOG_ARG_STR && arg->value.s) ? arg->value.s : "(null)");
+            break;
+        case 'p':
+            local_spec[n++] = conv; local_spec[n] = '\0';
+            written = snprintf(out, out_size, local_spec, (void *)(uintptr_t)arg_as_integer(arg));
+            break;
+        default:
+            written = 0;
+            break;
+    }
+
+    if (written < 0) {
+        return 0;
+    }
+    return ((size_t)written < out_size) ? (size_t)written : out_size - 1;
+}
+
+size_t thermal_log_format(const thermal_log_record_t *record, char *buffer, size_t buf_size) {
+    if (!record || !record->fmt || !buffer || buf_size == 0) {
+        return 0;
+    }
+
+    const char *p = record->fmt;
+    size_t len = 0;
+    uint8_t arg_index = 0;
+
+    while (*p && len < buf_size - 1) {
+        if (*p != '%') {
+            buffer[len++] = *p++;
+            continue;
+        }
+
+        if (p[1] == '%') {
+            buffer[len++] = '%';
+            p += 2;
+            continue;
+        }
+
+        const char *spec = p++;
+        int stars[2];
+        uint8_t star_count = 0;
+        while (*p && strchr("-+ #0123456789.*hlzjtL", *p)) {
+            /* As in printf, each '*' takes the next argument before the value itself. */
+            if (*p == '*' && star_count < 2 && arg_index < record->arg_count) {
+                stars[star_count++] = (int)(int64_t)arg_as_integer(&record->args[arg_index++]);
+            }
+            p++;
+        }
+
+        char conv = *p;
+        if (!conv) {
+            break;
+        }
+        p++;
+
+        if (arg_index < record->arg_count) {
+            len += format_arg(buffer + len, buf_size - len, spec, (size_t)(p - 1 - spec), conv, &record->args[arg_index], stars, star_count);
+            arg_index++;
+        }
+    }
+
+    buffer[len] = '\0';
+    return len;
+}
+
+size_t thermal_log_flush(void) {
+    thermal_log_record_t record;
+    char line[THERMAL_LOG_LINE_MAX];
+    size_t count = 0;
+
+    if (platform_atomic_load(&log_ready) != 2) {
+        return 0;
+    }
+
+    while (log_pop(&record)) {
+        thermal_log_format(&record, line, sizeof(line));
+        if (log_sink) {
+            log_sink(record.level, record.timestamp_us, line);
+        } else {
+            fputs(line, stdout);
+        }
+        count++;
+    }
+
+    if (count > 0 && !log_sink) {
+        fflush(stdout);
+    }
+
+    return count;
+}
+
+void thermal_log_set_sink(thermal_log_sink_fn sink) {
+    log_sink = sink;
+}
+
+uint32_t thermal_log_dropped(void) {
+    return platform_atomic_load(&log_dropped);
+}
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
@@ -0,0 +1,249 @@
+#include "thermal_mask.h"
+#include "thermal_simd.h"
+#include <string.h>
+
+#if defined(__GNUC__)
+#define POPCOUNT64(x) ((size_t)__builtin_popcountll(x))
+#else
+static size_t popcount64(uint64_t x) {
+    x = x - ((x >> 1) & 0x5555555555555555ull);
+    x = (x & 0x3333333333333333ull) + ((x >> 2) & 0x3333333333333333ull);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+    return (size_t)((x * 0x0101010101010101ull) >> 56);
+}
+#define POPCOUNT64(x) popcount64(x)
+#endif
+
+static size_t mask_words(const thermal_mask_t *mask) {
+    return (size_t)mask->words_per_row * mask->resolution.height;
+}
+
+/* Valid bits of a row's last word. */
+static uint64_t tail_mask(const thermal_mask_t *mask) {
+    uint16_t used = mask->resolution.width % 64;
+    return used ? ((uint64_t)1 << used) - 1 : ~(uint64_t)0;
+}
+
+static int same_shape(const thermal_mask_t *a, const thermal_mask_t *b) {
+    return a->words && b->words &&
+           a->resolution.width == b->resolution.width && a->resolution.height == b->resolution.height;
+}
+
+thermal_status_t thermal_mask_init(thermal_mask_t *mask, const thermal_resolution_t *resolution, uint64_t *words, size_t word_count) {
+    if (!mask || !resolution || !words || resolution->width == 0 || resolution->height == 0) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    if (word_count < THERMAL_MASK_WORDS(resolution->width, resolution->height)) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    mask->words = words;
+    mask->resolution = *resolution;
+    mask->words_per_row = (uint16_t)THERMAL_MASK_WORDS_PER_ROW(resolution->width);
+    memset(words, 0, mask_words(mask) * sizeof(uint64_t));
+
+    return THERMAL_OK;
+}
+
+thermal_status_t thermal_mask_threshold(thermal_mask_t *mask, const float *frame, float threshold) {
+    if (!mask || !mask->words || !frame) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    const thermal_simd_ops_t *simd = thermal_simd_ops();
+    uint16_t width = mask->resolution.width;
+
+    for (uint16_t y = 0; y < mask->resolution.height; y++) {
+        simd->threshold_bits(frame + (size_t)y * width, width, threshold, mask->words + (size_t)y * mask->words_per_row);
+    }
+
+    return THERMAL_OK;
+}
+
+thermal_status_t thermal_mask_set_rect(thermal_mask_t *mask, const thermal_rect_t *rect, uint8_t value) {
+    if (!mask || !mask->words || !rect) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    if ((uint32_t)rect->x + rect->width > mask->resolution.width || (uint32_t)rect->y + rect->height > mask->resolution.height) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    if (rect->width == 0) {
+        return THERMAL_OK;
+    }
+
+    uint32_t x_end = (uint32_t)rect->x + rect->width;
+    uint16_t first = rect->x / 64;
+    uint16_t last = (uint16_t)((x_end - 1) / 64);
+    uint64_t first_bits = ~(uint64_t)0 << (rect->x % 64);
+    uint64_t last_bits = (x_end % 64) ? ((uint64_t)1 << (x_end % 64)) - 1 : ~(uint64_t)0;
+
+    for (uint16_t y = rect->y; y < rect->y + rect->height; y++) {
+        uint64_t *row = mask->words + (size_t)y * mask->words_per_row;
+
+        for (uint16_t k = first; k <= last; k++) {
+            uint64_t bits = ~(uint64_t)0;
+            if (k == first) bits &= first_bits;
+            if (k == last) bits &= last_bits;
+            row[k] = value ? (row[k] | bits) : (row[k] & ~bits);
+        }
+    }
+
+    return THERMAL_OK;
+}
+
+uint8_t thermal_mask_get(const thermal_mask_t *mask, uint16_t x, uint16_t y) {
+    if (!mask || !mask->words || x >= mask->resolution.width || y >= mask->resolution.height) {
+        return 0;
+    }
+
+    return (uint8_t)((mask->words[(size_t)y * mask->words_per_row + x / 64] >> (x % 64)) & 1);
+}
+
+void thermal_mask_invert(thermal_mask_t *mask) {
+    if (!mask || !mask->words) {
+        return;
+    }
+
+    uint64_t tail = tail_mask(mask);
+    for (uint16_t y = 0; y < mask->resolution.height; y++) {
+        uint64_t *row = mask->words + (size_t)y * mask->words_per_row;
+        for (uint16_t k = 0; k < mask->words_per_row; k++) {
+            row[k] = ~row[k];
+        }
+        row[mask->words_per_row - 1] &= tail;
+    }
+}
+
+thermal_status_t thermal_mask_combine(const thermal_mask_t *a, const thermal_mask_t *b, thermal_mask_op_t op, thermal_mask_t *dst) {
+    if (!a || !b || !dst || !same_shape(a, b) || !same_shape(a, dst)) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    size_t count = mask_words(a);
+    const uint64_t *wa = a->words;
+    const uint64_t *wb = b->words;
+    uint64_t *out = dst->words;
+
+    switch (op) {
+        case THERMAL_MASK_AND:
+            for (size_t i = 0; i < count; i++) out[i] = wa[i] & wb[i];
+            break;
+        case THERMAL_MASK_OR:
+            for (size_t i = 0; i < count; i++) out[i] = wa[i] | wb[i];
+            break;
+        case THERMAL_MASK_XOR:
+            for (size_t i = 0; i < count; i++) out[i] = wa[i] ^ wb[i];
+            break;
+        case THERMAL_MASK_AND_NOT:
+            for (size_t i = 0; i < count; i++) out[i] = wa[i] & ~wb[i];
+            break;
+        default:
+            return THERMAL_ERR_INVALID_ARG;
+    }
+
+    return THERMAL_OK;
+}
+
+/*
+ * 3x3 morphology is separable: a vertical pass from src into dst, then a horizontal pass over each dst row
+ * in place. Pixels outside the frame are ignored, so erosion does not eat the border of small sensors.
+ */
+static thermal_status_t morph(const thermal_mask_t *src, thermal_mask_t *dst, uint8_t dilate) {
+    if (!src || !dst || !same_shape(src, dst) || src->words == dst->words) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    uint16_t height = src->resolution.height;
+    uint16_t words_per_row = src->words_per_row;
+    uint64_t tail = tail_mask(src);
+    /* Bit of the last pixel in the row's last word, treated as having a set neighbour on its right when eroding. */
+    uint64_t edge = (uint64_t)1 << ((src->resolution.width - 1) % 64);
+
+    for (uint16_t y = 0; y < height; y++) {
+        const uint64_t *row = src->words + (size_t)y * words_per_row;
+        const uint64_t *up = y > 0 ? row - words_per_row : row;
+        const uint64_t *down = y + 1 < height ? row + words_per_row : row;
+        uint64_t *out = dst->words + (size_t)y * words_per_row;
+
+        for (uint16_t k = 0; k < words_per_row; k++) {
+            out[k] = dilate ? (up[k] | row[k] | down[k]) : (up[k] & row[k] & down[k]);
+        }
+
+        uint64_t prev = dilate ? 0 : ~(uint64_t)0;
+        for (uint16_t k = 0; k < words_per_row; k++) {
+            uint64_t cur = out[k];
+            uint8_t last = (k + 1 == words_per_row);
+            uint64_t next = last ? (dilate ? 0 : ~(uint64_t)0) : out[k + 1];
+            uint64_t left = (cur << 1) | (prev >> 63);
+            uint64_t right = (cur >> 1) | (next << 63);
+
+            if (dilate) {
+                out[k] = cur | left | right;
+            } else {
+                if (last) {
+                    right |= edge;
+                }
+                out[k] = cur & left & right;
+            }
+
+            if (last) {
+                out[k] &= tail;
+            }
+            prev = cur;
+        }
+    }
+
+    return THERMAL_OK;
+}
+
+thermal_status_t thermal_mask_erode(const thermal_mask_t *src, thermal_mask_t *dst) {
+    return morph(src, dst, 0);
+}
+
+thermal_status_t thermal_mask_dilate(const thermal_mask_t *src, thermal_mask_t *dst) {
+    return morph(src, dst, 1);
+}
+
+thermal_status_t thermal_mask_open(const thermal_mask_t *src, thermal_mask_t *dst, thermal_mask_t *scratch) {
+    thermal_status_t status = morph(src, scratch, 0);
+    return status == THERMAL_OK ? morph(scratch, dst, 1) : status;
+}
+
+thermal_status_t thermal_mask_close(const thermal_mask_t *src, thermal_mask_t *dst, thermal_mask_t *scratch) {
+    thermal_status_t status = morph(src, scratch, 1);
+    return status == THERMAL_OK ? morph(scratch, dst, 0) : status;
+}
+
+size_t thermal_mask_count(const thermal_mask_t *mask) {
+    if (!mask || !mask->words) {
+        return 0;
+    }
+
+    size_t count = mask_words(mask);
+    size_t total = 0;
+    for (size_t i = 0; i < count; i++) {
+        total += POPCOUNT64(mask->words[i]);
+    }
+    return total;
+}
+
+size_t thermal_mask_count_and(const thermal_mask_t *a, const thermal_mask_t *b) {
+    if (!a || !b || !same_shape(a, b)) {
+        return 0;
+    }
+
+    size_t count = mask_words(a);
+    size_t total = 0;
+    for (size_t i = 0; i < count; i++) {
+        total += POPCOUNT64(a->words[i] & b->words[i]);
+    }
+    return total;
+}
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
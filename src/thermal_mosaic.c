@@ -0,0 +1,201 @@
+#include "thermal_mosaic.h"
+#include <string.h>
+
+static void rotated_size(const thermal_mosaic_tile_t *tile, uint16_t *width, uint16_t *height) {
+    if (tile->rotation == THERMAL_ROTATE_90 || tile->rotation == THERMAL_ROTATE_270) {
+        *width = tile->resolution.height;
+        *height = tile->resolution.width;
+    } else {
+        *width = tile->resolution.width;
+        *height = tile->resolution.height;
+    }
+}
+
+/* Maps a position inside the placed (rotated) tile back to the sensor's native pixel. */
+static void unrotate(const thermal_mosaic_tile_t *tile, int u, int v, int *sx, int *sy) {
+    int w = tile->resolution.width;
+    int h = tile->resolution.height;
+
+    switch (tile->rotation) {
+        case THERMAL_ROTATE_90: *sx = v; *sy = h - 1 - u; break;
+        case THERMAL_ROTATE_180: *sx = w - 1 - u; *sy = h - 1 - v; break;
+        case THERMAL_ROTATE_270: *sx = w - 1 - v; *sy = u; break;
+        default: *sx = u; *sy = v; break;
+    }
+}
+
+static int tile_covers(const thermal_mosaic_tile_t *tile, int mx, int my, int *u, int *v) {
+    uint16_t width, height;
+    rotated_size(tile, &width, &height);
+
+    *u = mx - tile->offset_x;
+    *v = my - tile->offset_y;
+
+    return *u >= 0 && *v >= 0 && *u < width && *v < height;
+}
+
+/* Feather weight ramps up linearly from each tile edge so overlaps cross-fade. */
+static float edge_weight(const thermal_mosaic_tile_t *tile, int sx, int sy) {
+    int w = tile->resolution.width;
+    int h = tile->resolution.height;
+    int d = sx + 1;
+
+    if (w - sx < d) d = w - sx;
+    if (sy + 1 < d) d = sy + 1;
+    if (h - sy < d) d = h - sy;
+
+    return (float)d;
+}
+
+static thermal_status_t validate_tiles(const thermal_mosaic_tile_t *tiles, uint8_t tile_count, const thermal_resolution_t *output) {
+    if (!tiles || !output || tile_count == 0 || tile_count > THERMAL_MOSAIC_MAX_TILES) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    if (output->width == 0 || output->height == 0) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    for (uint8_t t = 0; t < tile_count; t++) {
+        if (tiles[t].resolution.width == 0 || tiles[t].resolution.height == 0 ||
+            tiles[t].rotation > THERMAL_ROTATE_270) {
+            return THERMAL_ERR_INVALID_ARG;
+        }
+    }
+
+    return THERMAL_OK;
+}
+
+thermal_status_t thermal_mosaic_table_size(const thermal_mosaic_tile_t *tiles, uint8_t tile_count, const thermal_resolution_t *output, size_t *offset_count, size_t *tap_count) {
+    thermal_status_t status = validate_tiles(tiles, tile_count, output);
+    if (status != THERMAL_OK) {
+        return status;
+    }
+
+    if (!offset_count || !tap_count) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    size_t taps = 0;
+    for (int my = 0; my < output->height; my++) {
+        for (int mx = 0; mx < output->width; mx++) {
+            for (uint8_t t = 0; t < tile_count; t++) {
+                int u, v;
+                if (tile_covers(&tiles[t], mx, my, &u, &v)) {
+                    taps++;
+                }
+            }
+        }
+    }
+
+    *offset_count = (size_t)output->width * output->height + 1;
+    *tap_count = taps;
+
+    return THERMAL_OK;
+}
+
+thermal_status_t thermal_mosaic_init(thermal_mosaic_t *mosaic, const thermal_mosaic_tile_t *tiles, uint8_t tile_count, const thermal_resolution_t *output, float fill_value, uint32_t *offsets, size_t offset_count, thermal_mosaic_tap_t *taps, size_t tap_capacity) {
+    size_t needed_offsets, needed_taps;
+    thermal_status_t status = thermal_mosaic_table_size(tiles, tile_count, output, &needed_offsets, &needed_taps);
+    if (status != THERMAL_OK) {
+        return status;
+    }
+
+    if (!mosaic || !offsets || !taps || offset_count < needed_offsets || tap_capacity < needed_taps) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    memset(mosaic, 0, sizeof(*mosaic));
+    mosaic->output = *output;
+    mosaic->tile_count = tile_count;
+    mosaic->offsets = offsets;
+    mosaic->taps = taps;
+    mosaic->fill_value = fill_value;
+
+    for (uint8_t t = 0; t < tile_count; t++) {
+        mosaic->tile_res[t] = tiles[t].resolution;
+    }
+
+    uint32_t tap = 0;
+    size_t pixel = 0;
+
+    for (int my = 0; my < output->height; my++) {
+        for (int mx = 0; mx < output->width; mx++) {
+            uint32_t first = tap;
+            float weight_sum = 0.0f;
+            offsets[pixel++] = first;
+
+            for (uint8_t t = 0; t < tile_count; t++) {
+                int u, v, sx, sy;
+                if (!tile_covers(&tiles[t], mx, my, &u, &v)) {
+                    continue;
+                }
+
+                unrotate(&tiles[t], u, v, &sx, &sy);
+                taps[tap].tile = t;
+                taps[tap].src_index = (uint32_t)sy * tiles[t].resolution.width + (uint32_t)sx;
+                taps[tap].weight = edge_weight(&tiles[t], sx, sy);
+                weight_sum += taps[tap].weight;
+                tap++;
+            }
+
+            for (uint32_t i = first; i < tap; i++) {
+                taps[i].weight /= weight_sum;
+            }
+        }
+    }
+
+    offsets[pixel] = tap;
+    return THERMAL_OK;
+}
+
+thermal_status_t thermal_mosaic_compose(const thermal_mosaic_t *mosaic, const thermal_frame_t *const *frames, thermal_frame_t *output) {
+    if (!mosaic || !frames || !output || !output->data || !mosaic->offsets) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    const float *sources[THERMAL_MOSAIC_MAX_TILES];
+    uint8_t unchanged = 1;
+    for (uint8_t t = 0; t < mosaic->tile_count; t++) {
+        if (!frames[t] || !frames[t]->data ||
+            frames[t]->resolution.width != mosaic->tile_res[t].width ||
+            frames[t]->resolution.height != mosaic->tile_res[t].height) {
+            return THERMAL_ERR_FRAME_INVALID;
+        }
+        sources[t] = frames[t]->data;
+        unchanged &= frames[t]->unchanged;
+    }
+
+    size_t total_pixels = (size_t)mosaic->output.width * mosaic->output.height;
+    const uint32_t *offsets = mosaic->offsets;
+    const thermal_mosaic_tap_t *taps = mosaic->taps;
+    float *dst = output->data;
+
+    for (size_t p = 0; p < total_pixels; p++) {
+        uint32_t first = offsets[p];
+        uint32_t last = offsets[p + 1];
+
+        if (last - first == 1) {
+            dst[p] = sources[taps[first].tile][taps[first].src_index];
+        } else if (last == first) {
+            dst[p] = mosaic->fill_value;
+        } else {
+            float sum = 0.0f;
+            for (uint32_t i = first; i < last; i++) {
+                sum += sources[taps[i].tile][taps[i].src_index] * taps[i].weight;
+            }
+            dst[p] = sum;
+        }
+    }
+
+    output->resolution = mosaic->output;
+    output->timestamp = frames[0]->timestamp;
+    output->unchanged = unchanged;
+
+    return THERMAL_OK;
+}
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
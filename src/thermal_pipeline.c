@@ -0,0 +1,231 @@
+#include "thermal_pipeline.h"
+#include <stdio.h>
+#include <string.h>
+
+#define PIPELINE_RING_MASK (THERMAL_PIPELINE_MAX_FRAMES - 1)
+#define PIPELINE_POLL_US 500
+
+static void ring_reset(thermal_frame_ring_t *ring) {
+    for (int i = 0; i < THERMAL_PIPELINE_MAX_FRAMES; i++) {
+        atomic_init(&ring->slots[i], THERMAL_PIPELINE_NO_FRAME);
+    }
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->tail, 0);
+}
+
+/* Each ring has one pushing thread (the task for ready, the consumer for free), so head needs no CAS. */
+static void ring_push(thermal_frame_ring_t *ring, uint8_t index) {
+    uint32_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    atomic_store_explicit(&ring->slots[head & PIPELINE_RING_MASK], index, memory_order_relaxed);
+    platform_atomic_store(&ring->head, head + 1);
+}
+
+/* Both the consumer and the evicting producer may pop, so tail advances by CAS. */
+static uint8_t ring_pop(thermal_frame_ring_t *ring) {
+    uint32_t tail = platform_atomic_load(&ring->tail);
+
+    for (;;) {
+        uint32_t head = platform_atomic_load(&ring->head);
+        if (tail == head) {
+            return THERMAL_PIPELINE_NO_FRAME;
+        }
+
+        uint8_t index = atomic_load_explicit(&ring->slots[tail & PIPELINE_RING_MASK], memory_order_relaxed);
+        if (platform_atomic_cas(&ring->tail, &tail, tail + 1)) {
+            return index;
+        }
+    }
+}
+
+thermal_status_t thermal_pipeline_init(thermal_pipeline_t *pipeline, thermal_device_t *device, float *storage, size_t storage_len, thermal_drop_policy_t policy, uint8_t rate_hz) {
+    if (!pipeline || !device || !storage || rate_hz == 0) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    if (!device->initialized) {
+        return THERMAL_ERR_NOT_INIT;
+    }
+
+    size_t frame_pixels = (size_t)device->resolution.width * device->resolution.height;
+    size_t count = storage_len / frame_pixels;
+    if (count > THERMAL_PIPELINE_MAX_FRAMES) {
+        count = THERMAL_PIPELINE_MAX_FRAMES;
+    }
+
+    if (count < 2) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    memset(pipeline, 0, sizeof(*pipeline));
+    pipeline->device = device;
+    pipeline->frame_count = (uint8_t)count;
+    pipeline->policy = policy;
+    pipeline->period_us = 1000000U / rate_hz;
+    pipeline->in_flight = THERMAL_PIPELINE_NO_FRAME;
+
+    ring_reset(&pipeline->ready);
+    ring_reset(&pipeline->free);
+
+    for (uint8_t i = 0; i < pipeline->frame_count; i++) {
+        pipeline->frames[i].data = storage + i * frame_pixels;
+        pipeline->frames[i].resolution = device->resolution;
+        pipeline->frames[i].timestamp = 0;
+        pipeline->frames[i].unchanged = 0;
+        ring_push(&pipeline->free, i);
+    }
+
+    atomic_init(&pipeline->running, 0);
+    atomic_init(&pipeline->acquired, 0);
+    atomic_init(&pipeline->delivered, 0);
+    atomic_init(&pipeline->dropped_oldest, 0);
+    atomic_init(&pipeline->dropped_newest, 0);
+    atomic_init(&pipeline->errors, 0);
+
+    return THERMAL_OK;
+}
+
+static uint8_t take_buffer(thermal_pipeline_t *pipeline) {
+    uint8_t index = ring_pop(&pipeline->free);
+    if (index != THERMAL_PIPELINE_NO_FRAME) {
+        return index;
+    }
+
+    if (pipeline->policy == THERMAL_DROP_OLDEST) {
+        index = ring_pop(&pipeline->ready);
+        if (index != THERMAL_PIPELINE_NO_FRAME) {
+            platform_atomic_fetch_add(&pipeline->dropped_oldest, 1);
+            return index;
+        }
+    }
+
+    platform_atomic_fetch_add(&pipeline->dropped_newest, 1);
+    return THERMAL_PIPELINE_NO_FRAME;
+}
+
+static void acquisition_task(void *arg) {
+    thermal_pipeline_t *pipeline = (thermal_pipeline_t *)arg;
+    uint8_t current = THERMAL_PIPELINE_NO_FRAME;
+    uint64_t next_deadline = platform_time_us();
+
+    while (platform_atomic_load(&pipeline->running)) {
+        if (current == THERMAL_PIPELINE_NO_FRAME) {
+            current = take_buffer(pipeline);
+        }
+
+        if (current != THERMAL_PIPELINE_NO_FRAME) {
+            thermal_status_t status = thermal_get_frame(pipeline->device, &pipeline->frames[current]);
+            if (status == THERMAL_OK) {
+                platform_atomic_fetch_add(&pipeline->acquired, 1);
+                ring_push(&pipeline->ready, current);
+                current = THERMAL_PIPELINE_NO_FRAME;
+            } else {
+                platform_atomic_fetch_add(&pipeline->errors, 1);
+            }
+        }
+
+        next_deadline += pipeline->period_us;
+        uint64_t now = platform_time_us();
+        if (next_deadline < now) {
+            next_deadline = now;
+        }
+        platform_sleep_until_us(next_deadline);
+    }
+
+    /* The free ring belongs to the consumer; thermal_pipeline_stop() returns this after the join. */
+    pipeline->in_flight = current;
+}
+
+thermal_status_t thermal_pipeline_start(thermal_pipeline_t *pipeline) {
+    if (!pipeline || !pipeline->device) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    if (platform_atomic_load(&pipeline->running)) {
+        return THERMAL_OK;
+    }
+
+    platform_atomic_store(&pipeline->running, 1);
+    if (platform_thread_create(&pipeline->thread, acquisition_task, pipeline) != 0) {
+        platform_atomic_store(&pipeline->running, 0);
+        return THERMAL_ERR_UNSUPPORTED;
+    }
+
+    return THERMAL_OK;
+}
+
+thermal_status_t thermal_pipeline_stop(thermal_pipeline_t *pipeline) {
+    if (!pipeline) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    if (!platform_atomic_load(&pipeline->running)) {
+        return THERMAL_OK;
+    }
+
+    platform_atomic_store(&pipeline->running, 0);
+    platform_thread_join(&pipeline->thread);
+
+    if (pipeline->in_flight != THERMAL_PIPELINE_NO_FRAME) {
+        ring_push(&pipeline->free, pipeline->in_flight);
+        pipeline->in_flight = THERMAL_PIPELINE_NO_FRAME;
+    }
+
+    return THERMAL_OK;
+}
+
+thermal_status_t thermal_pipeline_acquire(thermal_pipeline_t *pipeline, thermal_frame_t **frame, uint32_t timeout_us) {
+    if (!pipeline || !frame) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    uint64_t deadline = platform_time_us() + timeout_us;
+
+    for (;;) {
+        uint8_t index = ring_pop(&pipeline->ready);
+        if (index != THERMAL_PIPELINE_NO_FRAME) {
+            platform_atomic_fetch_add(&pipeline->delivered, 1);
+            *frame = &pipeline->frames[index];
+            return THERMAL_OK;
+        }
+
+        uint64_t now = platform_time_us();
+        if (now >= deadline) {
+            *frame = NULL;
+            return THERMAL_ERR_TIMEOUT;
+        }
+
+        platform_sleep_us((deadline - now) < PIPELINE_POLL_US ? (uint32_t)(deadline - now) : PIPELINE_POLL_US);
+    }
+}
+
+thermal_status_t thermal_pipeline_release(thermal_pipeline_t *pipeline, thermal_frame_t *frame) {
+    if (!pipeline || !frame) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    if (frame < pipeline->frames || frame >= pipeline->frames + pipeline->frame_count) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    ring_push(&pipeline->free, (uint8_t)(frame - pipeline->frames));
+    return THERMAL_OK;
+}
+
+thermal_status_t thermal_pipeline_get_stats(thermal_pipeline_t *pipeline, thermal_pipeline_stats_t *stats) {
+    if (!pipeline || !stats) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    stats->acquired = platform_atomic_load(&pipeline->acquired);
+    stats->delivered = platform_atomic_load(&pipeline->delivered);
+    stats->dropped_oldest = platform_atomic_load(&pipeline->dropped_oldest);
+    stats->dropped_newest = platform_atomic_load(&pipeline->dropped_newest);
+    stats->errors = platform_atomic_load(&pipeline->errors);
+
+    return THERMAL_OK;
+}
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
@@ -1,46 +1,347 @@
 #include "thermal_processing.h"
+#include "thermal_trace.h"
+#include "thermal_simd.h"
+#include "sensors/amg8833.h"
+#include "sensors/mlx90640.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
 #include <float.h>
 
-thermal_status_t thermal_find_minmax(const float *frame, const thermal_resolution_t *resolution, thermal_minmax_t *result) {
-    if (!frame || !resolution || !result) {
-        return THERMAL_ERR_INVALID_ARG;
+#ifndef THERMAL_SPECIALIZED_KERNELS
+#define THERMAL_SPECIALIZED_KERNELS 1
+#endif
+
+/* Cores take the geometry as arguments; forcing inlining lets constant-geometry wrappers fold and unroll them. */
+#if defined(__GNUC__)
+#define KERNEL_INLINE static inline __attribute__((always_inline))
+#else
+#define KERNEL_INLINE static inline
+#endif
+
+#define SORT2(a, b) do { float lo_ = (a) < (b) ? (a) : (b); (b) = (a) < (b) ? (b) : (a); (a) = lo_; } while (0)
+
+KERNEL_INLINE void minmax_core(const float *frame, uint16_t width, uint16_t height, thermal_minmax_t *result) {
+    size_t total_pixels = (size_t)width * height;
+    float min_temp = FLT_MAX;
+    float max_temp = -FLT_MAX;
+    size_t min_index = 0;
+    size_t max_index = 0;
+    
+    for (size_t i = 0; i < total_pixels; i++) {
+        float temp = frame[i];
+        
+        if (temp < min_temp) {
+            min_temp = temp;
+            min_index = i;
+        }
+        
+        if (temp > max_temp) {
+            max_temp = temp;
+            max_index = i;
+        }
     }
     
-    size_t total_pixels = resolution->width * resolution->height;
-    if (total_pixels == 0) {
-        return THERMAL_ERR_INVALID_ARG;
+    result->min_temp = min_temp;
+    result->max_temp = max_temp;
+    result->min_x = (uint16_t)(min_index % width);
+    result->min_y = (uint16_t)(min_index / width);
+    result->max_x = (uint16_t)(max_index % width);
+    result->max_y = (uint16_t)(max_index / width);
+}
+
+static uint8_t is_local_max_clamped(const float *frame, uint16_t width, uint16_t height, uint16_t x, uint16_t y, float temp) {
+    for (int dy = -1; dy <= 1; dy++) {
+        for (int dx = -1; dx <= 1; dx++) {
+            if (dx == 0 && dy == 0) continue;
+            
+            int nx = (int)x + dx;
+            int ny = (int)y + dy;
+            
+            if (nx >= 0 && nx < (int)width && ny >= 0 && ny < (int)height) {
+                if (frame[ny * width + nx] > temp) {
+                    return 0;
+                }
+            }
+        }
     }
     
-    result->min_temp = FLT_MAX;
-    result->max_temp = -FLT_MAX;
-    result->min_x = 0;
-    result->min_y = 0;
-    result->max_x = 0;
-    result->max_y = 0;
+    return 1;
+}
+
+/* Border pixels take the bounds-checked path; interior pixels compare all 8 neighbours directly. */
+KERNEL_INLINE size_t hotspots_core(const float *frame, uint16_t width, uint16_t height, float threshold, thermal_hotspot_t *hotspots, size_t max_spots) {
+    size_t found = 0;
     
-    for (uint16_t y = 0; y < resolution->height; y++) {
-        for (uint16_t x = 0; x < resolution->width; x++) {
-            size_t index = y * resolution->width + x;
-            float temp = frame[index];
+    for (uint16_t y = 0; y < height; y++) {
+        const float *row = frame + (size_t)y * width;
+        uint8_t border_row = (y == 0 || y == height - 1);
+        
+        for (uint16_t x = 0; x < width; x++) {
+            float temp = row[x];
+            if (!(temp >= threshold)) {
+                continue;
+            }
             
-            if (temp < result->min_temp) {
-                result->min_temp = temp;
-                result->min_x = x;
-                result->min_y = y;
+            uint8_t is_local_max;
+            if (border_row || x == 0 || x == width - 1) {
+                is_local_max = is_local_max_clamped(frame, width, height, x, y, temp);
+            } else {
+                const float *up = row - width;
+                const float *down = row + width;
+                is_local_max = !(up[x - 1] > temp || up[x] > temp || up[x + 1] > temp ||
+                                 row[x - 1] > temp || row[x + 1] > temp ||
+                                 down[x - 1] > temp || down[x] > temp || down[x + 1] > temp);
             }
             
-            if (temp > result->max_temp) {
-                result->max_temp = temp;
-                result->max_x = x;
-                result->max_y = y;
+            if (is_local_max) {
+                hotspots[found].x = x;
+                hotspots[found].y = y;
+                hotspots[found].temperature = temp;
+                if (++found == max_spots) {
+                    return found;
+                }
             }
         }
     }
     
+    return found;
+}
+
+/* simd is NULL for the inline scalar loop, otherwise its row kernel does each output row. */
+KERNEL_INLINE void interpolate_bilinear_core(const float *src, uint16_t src_width, uint16_t src_height, float *dst, uint16_t dst_width, uint16_t dst_height, const thermal_rect_t *rect, const thermal_simd_ops_t *simd) {
+    float x_ratio = (float)(src_width - 1) / (float)(dst_width - 1);
+    float y_ratio = (float)(src_height - 1) / (float)(dst_height - 1);
+    uint16_t x_end = rect->x + rect->width;
+    uint16_t y_end = rect->y + rect->height;
+    
+    for (uint16_t y = rect->y; y < y_end; y++) {
+        float src_y = y * y_ratio;
+        uint16_t y1 = (uint16_t)src_y;
+        uint16_t y2 = (y1 + 1 < src_height) ? y1 + 1 : y1;
+        float dy = src_y - y1;
+        const float *row1 = src + y1 * src_width;
+        const float *row2 = src + y2 * src_width;
+        float *out = dst + y * dst_width;
+        
+        if (simd) {
+            simd->bilinear_row(row1, row2, src_width, x_ratio, dy, rect->x, x_end, out);
+            continue;
+        }
+        
+        for (uint16_t x = rect->x; x < x_end; x++) {
+            float src_x = x * x_ratio;
+            uint16_t x1 = (uint16_t)src_x;
+            uint16_t x2 = (x1 + 1 < src_width) ? x1 + 1 : x1;
+            float dx = src_x - x1;
+            
+            float r1 = row1[x1] * (1.0f - dx) + row1[x2] * dx;
+            float r2 = row2[x1] * (1.0f - dx) + row2[x2] * dx;
+            out[x] = r1 * (1.0f - dy) + r2 * dy;
+        }
+    }
+}
+
+/* Median of 9 by a fixed exchange network (Paeth/Devillard); p is clobbered. */
+static inline float median9(float *p) {
+    SORT2(p[1], p[2]); SORT2(p[4], p[5]); SORT2(p[7], p[8]);
+    SORT2(p[0], p[1]); SORT2(p[3], p[4]); SORT2(p[6], p[7]);
+    SORT2(p[1], p[2]); SORT2(p[4], p[5]); SORT2(p[7], p[8]);
+    SORT2(p[0], p[3]); SORT2(p[5], p[8]); SORT2(p[4], p[7]);
+    SORT2(p[3], p[6]); SORT2(p[1], p[4]); SORT2(p[2], p[5]);
+    SORT2(p[4], p[7]); SORT2(p[4], p[2]); SORT2(p[6], p[4]);
+    SORT2(p[4], p[2]);
+    return p[4];
+}
+
+static void median3_clamped(const float *src, uint16_t width, uint16_t height, float *dst, uint16_t x, uint16_t y) {
+    float window[9];
+    size_t window_idx = 0;
+    
+    for (int ky = -1; ky <= 1; ky++) {
+        for (int kx = -1; kx <= 1; kx++) {
+            int nx = (int)x + kx;
+            int ny = (int)y + ky;
+            
+            if (nx < 0) nx = 0;
+            if (ny < 0) ny = 0;
+            if (nx >= (int)width) nx = width - 1;
+            if (ny >= (int)height) ny = height - 1;
+            
+            window[window_idx++] = src[ny * width + nx];
+        }
+    }
+    
+    dst[y * width + x] = median9(window);
+}
+
+KERNEL_INLINE void median3_core(const float *src, uint16_t width, uint16_t height, float *dst, const thermal_simd_ops_t *simd) {
+    for (uint16_t y = 0; y < height; y++) {
+        if (y == 0 || y == height - 1) {
+            for (uint16_t x = 0; x < width; x++) {
+                median3_clamped(src, width, height, dst, x, y);
+            }
+            continue;
+        }
+        
+        const float *up = src + (size_t)(y - 1) * width;
+        const float *row = up + width;
+        const float *down = row + width;
+        
+        median3_clamped(src, width, height, dst, 0, y);
+        if (simd) {
+            if (width > 2) {
+                simd->median3_row(up, row, down, 1, (uint16_t)(width - 1), dst + (size_t)y * width);
+            }
+        } else {
+            for (uint16_t x = 1; x + 1 < width; x++) {
+                float window[9] = {
+                    up[x - 1], up[x], up[x + 1],
+                    row[x - 1], row[x], row[x + 1],
+                    down[x - 1], down[x], down[x + 1]
+                };
+                dst[(size_t)y * width + x] = median9(window);
+            }
+        }
+        if (width > 1) {
+            median3_clamped(src, width, height, dst, width - 1, y);
+        }
+    }
+}
+
+typedef struct {
+    uint16_t width;
+    uint16_t height;
+    void (*minmax)(const float *frame, thermal_minmax_t *result);
+    size_t (*hotspots)(const float *frame, float threshold, thermal_hotspot_t *hotspots, size_t max_spots);
+    void (*median3)(const float *src, float *dst);
+} geometry_kernels_t;
+
+typedef struct {
+    uint16_t src_width;
+    uint16_t src_height;
+    uint16_t dst_width;
+    uint16_t dst_height;
+    void (*interpolate)(const float *src, float *dst, const thermal_rect_t *rect);
+} upscale_kernel_t;
+
+#if THERMAL_SPECIALIZED_KERNELS
+
+#define SPECIALIZE_GEOMETRY(name, W, H) \
+    static void minmax_##name(const float *frame, thermal_minmax_t *result) { \
+        minmax_core(frame, W, H, result); \
+    } \
+    static size_t hotspots_##name(const float *frame, float threshold, thermal_hotspot_t *hotspots, size_t max_spots) { \
+        return hotspots_core(frame, W, H, threshold, hotspots, max_spots); \
+    } \
+    static void median3_##name(const float *src, float *dst) { \
+        median3_core(src, W, H, dst, NULL); \
+    }
+
+#define GEOMETRY_ENTRY(name, W, H) { W, H, minmax_##name, hotspots_##name, median3_##name }
+
+#define SPECIALIZE_UPSCALE(SW, SH, DW, DH) \
+    static void interpolate_##SW##x##SH##_##DW##x##DH(const float *src, float *dst, const thermal_rect_t *rect) { \
+        interpolate_bilinear_core(src, SW, SH, dst, DW, DH, rect, NULL); \
+    }
+
+#define UPSCALE_ENTRY(SW, SH, DW, DH) { SW, SH, DW, DH, interpolate_##SW##x##SH##_##DW##x##DH }
+
+SPECIALIZE_GEOMETRY(amg8833, AMG8833_WIDTH, AMG8833_HEIGHT)
+SPECIALIZE_GEOMETRY(mlx90640, MLX90640_WIDTH, MLX90640_HEIGHT)
+
+static const geometry_kernels_t geometry_kernels[] = {
+    GEOMETRY_ENTRY(amg8833, AMG8833_WIDTH, AMG8833_HEIGHT),
+    GEOMETRY_ENTRY(mlx90640, MLX90640_WIDTH, MLX90640_HEIGHT)
+};
+
+/* Upscale targets are literal so the names paste; keep them in step with the sensor geometry. */
+_Static_assert(AMG8833_WIDTH == 8 && AMG8833_HEIGHT == 8, "update AMG8833 upscale kernels");
+_Static_assert(MLX90640_WIDTH == 32 && MLX90640_HEIGHT == 24, "update MLX90640 upscale kernels");
+
+SPECIALIZE_UPSCALE(8, 8, 32, 32)
+SPECIALIZE_UPSCALE(8, 8, 64, 64)
+SPECIALIZE_UPSCALE(8, 8, 240, 240)
+SPECIALIZE_UPSCALE(32, 24, 64, 48)
+SPECIALIZE_UPSCALE(32, 24, 128, 96)
+SPECIALIZE_UPSCALE(32, 24, 320, 240)
+
+static const upscale_kernel_t upscale_kernels[] = {
+    UPSCALE_ENTRY(8, 8, 32, 32),
+    UPSCALE_ENTRY(8, 8, 64, 64),
+    UPSCALE_ENTRY(8, 8, 240, 240),
+    UPSCALE_ENTRY(32, 24, 64, 48),
+    UPSCALE_ENTRY(32, 24, 128, 96),
+    UPSCALE_ENTRY(32, 24, 320, 240)
+};
+
+static const geometry_kernels_t *find_geometry_kernels(const thermal_resolution_t *resolution) {
+    for (size_t i = 0; i < sizeof(geometry_kernels) / sizeof(geometry_kernels[0]); i++) {
+        if (geometry_kernels[i].width == resolution->width && geometry_kernels[i].height == resolution->height) {
+            return &geometry_kernels[i];
+        }
+    }
+    return NULL;
+}
+
+static const upscale_kernel_t *find_upscale_kernel(const thermal_resolution_t *src_res, const thermal_resolution_t *dst_res) {
+    for (size_t i = 0; i < sizeof(upscale_kernels) / sizeof(upscale_kernels[0]); i++) {
+        const upscale_kernel_t *k = &upscale_kernels[i];
+        if (k->src_width == src_res->width && k->src_height == src_res->height &&
+            k->dst_width == dst_res->width && k->dst_height == dst_res->height) {
+            return k;
+        }
+    }
+    return NULL;
+}
+
+#else
+
+static const geometry_kernels_t *find_geometry_kernels(const thermal_resolution_t *resolution) {
+    (void)resolution;
+    return NULL;
+}
+
+static const upscale_kernel_t *find_upscale_kernel(const thermal_resolution_t *src_res, const thermal_resolution_t *dst_res) {
+    (void)src_res;
+    (void)dst_res;
+    return NULL;
+}
+
+#endif
+
+/* SIMD kernels when the CPU has them; NULL keeps the specialized/generic scalar paths. */
+static const thermal_simd_ops_t *vector_ops(void) {
+    const thermal_simd_ops_t *simd = thermal_simd_ops();
+    return simd->level == THERMAL_SIMD_SCALAR ? NULL : simd;
+}
+
+thermal_status_t thermal_find_minmax(const float *frame, const thermal_resolution_t *resolution, thermal_minmax_t *result) {
+    if (!frame || !resolution || !result) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+    
+    size_t total_pixels = resolution->width * resolution->height;
+    if (total_pixels == 0) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+    
+    const thermal_simd_ops_t *simd = vector_ops();
+    const geometry_kernels_t *kernels = find_geometry_kernels(resolution);
+    if (simd) {
+        size_t min_index, max_index;
+        simd->minmax(frame, total_pixels, &result->min_temp, &min_index, &result->max_temp, &max_index);
+        result->min_x = (uint16_t)(min_index % resolution->width);
+        result->min_y = (uint16_t)(min_index / resolution->width);
+        result->max_x = (uint16_t)(max_index % resolution->width);
+        result->max_y = (uint16_t)(max_index / resolution->width);
+    } else if (kernels) {
+        kernels->minmax(frame, result);
+    } else {
+        minmax_core(frame, resolution->width, resolution->height, result);
+    }
+    
     return THERMAL_OK;
 }
 
@@ -56,45 +357,33 @@ thermal_status_t thermal_find_hotspots(const float *frame, const thermal_resolut
         return THERMAL_ERR_INVALID_ARG;
     }
     
-    for (uint16_t y = 0; y < resolution->height && *found < max_spots; y++) {
-        for (uint16_t x = 0; x < resolution->width && *found < max_spots; x++) {
-            size_t index = y * resolution->width + x;
-            float temp = frame[index];
-            
-            if (temp >= threshold) {
-                uint8_t is_local_max = 1;
-                
-                for (int dy = -1; dy <= 1 && is_local_max; dy++) {
-                    for (int dx = -1; dx <= 1 && is_local_max; dx++) {
-                        if (dx == 0 && dy == 0) continue;
-                        
-                        int nx = (int)x + dx;
-                        int ny = (int)y + dy;
-                        
-                        if (nx >= 0 && nx < (int)resolution->width && ny >= 0 && ny < (int)resolution->height) {
-                            size_t neighbor_idx = ny * resolution->width + nx;
-                            if (frame[neighbor_idx] > temp) {
-                                is_local_max = 0;
-                            }
-                        }
-                    }
-                }
-                
-                if (is_local_max) {
-                    hotspots[*found].x = x;
-                    hotspots[*found].y = y;
-                    hotspots[*found].temperature = temp;
-                    (*found)++;
-                }
-            }
-        }
+    const geometry_kernels_t *kernels = find_geometry_kernels(resolution);
+    if (kernels) {
+        *found = kernels->hotspots(frame, threshold, hotspots, max_spots);
+    } else {
+        *found = hotspots_core(frame, resolution->width, resolution->height, threshold, hotspots, max_spots);
     }
     
     return THERMAL_OK;
 }
 
+static int region_valid(const thermal_resolution_t *resolution, const thermal_rect_t *region) {
+    return region->width > 0 && region->height > 0 &&
+           (uint32_t)region->x + region->width <= resolution->width &&
+           (uint32_t)region->y + region->height <= resolution->height;
+}
+
 thermal_status_t thermal_interpolate_bilinear(const float *src, const thermal_resolution_t *src_res, float *dst, const thermal_resolution_t *dst_res) {
-    if (!src || !src_res || !dst || !dst_res) {
+    if (!dst_res) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+    
+    thermal_rect_t full = { 0, 0, dst_res->width, dst_res->height };
+    return thermal_interpolate_bilinear_region(src, src_res, dst, dst_res, &full);
+}
+
+thermal_status_t thermal_interpolate_bilinear_region(const float *src, const thermal_resolution_t *src_res, float *dst, const thermal_resolution_t *dst_res, const thermal_rect_t *region) {
+    if (!src || !src_res || !dst || !dst_res || !region) {
         return THERMAL_ERR_INVALID_ARG;
     }
     
@@ -102,35 +391,23 @@ thermal_status_t thermal_interpolate_bilinear(const float *src, const thermal_re
         return THERMAL_ERR_INVALID_ARG;
     }
     
-    float x_ratio = (float)(src_res->width - 1) / (float)(dst_res->width - 1);
-    float y_ratio = (float)(src_res->height - 1) / (float)(dst_res->height - 1);
+    if (!region_valid(dst_res, region)) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+    
+    THERMAL_TRACE_BEGIN(THERMAL_STAGE_INTERPOLATE);
     
-    for (uint16_t y = 0; y < dst_res->height; y++) {
-        for (uint16_t x = 0; x < dst_res->width; x++) {
-            float src_x = x * x_ratio;
-            float src_y = y * y_ratio;
-            
-            uint16_t x1 = (uint16_t)src_x;
-            uint16_t y1 = (uint16_t)src_y;
-            uint16_t x2 = (x1 + 1 < src_res->width) ? x1 + 1 : x1;
-            uint16_t y2 = (y1 + 1 < src_res->height) ? y1 + 1 : y1;
-            
-            float dx = src_x - x1;
-            float dy = src_y - y1;
-            
-            float q11 = src[y1 * src_res->width + x1];
-            float q21 = src[y1 * src_res->width + x2];
-            float q12 = src[y2 * src_res->width + x1];
-            float q22 = src[y2 * src_res->width + x2];
-            
-            float r1 = q11 * (1.0f - dx) + q21 * dx;
-            float r2 = q12 * (1.0f - dx) + q22 * dx;
-            float interpolated = r1 * (1.0f - dy) + r2 * dy;
-            
-            dst[y * dst_res->width + x] = interpolated;
-        }
+    const thermal_simd_ops_t *simd = vector_ops();
+    const upscale_kernel_t *kernel = find_upscale_kernel(src_res, dst_res);
+    if (simd) {
+        interpolate_bilinear_core(src, src_res->width, src_res->height, dst, dst_res->width, dst_res->height, region, simd);
+    } else if (kernel) {
+        kernel->interpolate(src, dst, region);
+    } else {
+        interpolate_bilinear_core(src, src_res->width, src_res->height, dst, dst_res->width, dst_res->height, region, NULL);
     }
     
+    THERMAL_TRACE_END(THERMAL_STAGE_INTERPOLATE);
     return THERMAL_OK;
 }
 
@@ -142,7 +419,14 @@ static int compare_floats(const void *a, const void *b) {
     return 0;
 }
 
-thermal_status_t thermal_median_filter(const float *src, const thermal_resolution_t *resolution, float *dst, uint8_t kernel_size) {
+size_t thermal_median_filter_scratch_size(uint8_t kernel_size) {
+    if (kernel_size <= 3) {
+        return 0;
+    }
+    return THERMAL_ARENA_SIZE((size_t)kernel_size * kernel_size * sizeof(float));
+}
+
+thermal_status_t thermal_median_filter(const float *src, const thermal_resolution_t *resolution, float *dst, uint8_t kernel_size, thermal_arena_t *scratch) {
     if (!src || !resolution || !dst) {
         return THERMAL_ERR_INVALID_ARG;
     }
@@ -151,14 +435,39 @@ thermal_status_t thermal_median_filter(const float *src, const thermal_resolutio
         return THERMAL_ERR_INVALID_ARG;
     }
     
+    /* The 3x3 path clamps neighbours to width - 1 and height - 1, which underflow on an empty frame. */
+    if (resolution->width == 0 || resolution->height == 0) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+    
+    if (kernel_size == 3) {
+        THERMAL_TRACE_BEGIN(THERMAL_STAGE_FILTER);
+        
+        const thermal_simd_ops_t *simd = vector_ops();
+        const geometry_kernels_t *kernels = find_geometry_kernels(resolution);
+        if (simd) {
+            median3_core(src, resolution->width, resolution->height, dst, simd);
+        } else if (kernels) {
+            kernels->median3(src, dst);
+        } else {
+            median3_core(src, resolution->width, resolution->height, dst, NULL);
+        }
+        
+        THERMAL_TRACE_END(THERMAL_STAGE_FILTER);
+        return THERMAL_OK;
+    }
+    
     int half_kernel = kernel_size / 2;
     size_t kernel_area = kernel_size * kernel_size;
-    float *window = (float *)malloc(kernel_area * sizeof(float));
+    size_t mark = thermal_arena_mark(scratch);
+    float *window = (float *)thermal_arena_alloc(scratch, kernel_area * sizeof(float));
     
     if (!window) {
         return THERMAL_ERR_INVALID_ARG;
     }
     
+    THERMAL_TRACE_BEGIN(THERMAL_STAGE_FILTER);
+    
     for (uint16_t y = 0; y < resolution->height; y++) {
         for (uint16_t x = 0; x < resolution->width; x++) {
             size_t window_idx = 0;
@@ -182,36 +491,23 @@ thermal_status_t thermal_median_filter(const float *src, const thermal_resolutio
         }
     }
     
-    free(window);
+    thermal_arena_release(scratch, mark);
+    
+    THERMAL_TRACE_END(THERMAL_STAGE_FILTER);
     return THERMAL_OK;
 }
 
-static void temperature_to_rgb(float temp, float min_temp, float max_temp, uint8_t *r, uint8_t *g, uint8_t *b) {
-    float normalized = (temp - min_temp) / (max_temp - min_temp);
-    if (normalized < 0.0f) normalized = 0.0f;
-    if (normalized > 1.0f) normalized = 1.0f;
-    
-    if (normalized < 0.25f) {
-        *r = 0;
-        *g = 0;
-        *b = (uint8_t)(255 * (normalized / 0.25f));
-    } else if (normalized < 0.5f) {
-        *r = 0;
-        *g = (uint8_t)(255 * ((normalized - 0.25f) / 0.25f));
-        *b = 255;
-    } else if (normalized < 0.75f) {
-        *r = (uint8_t)(255 * ((normalized - 0.5f) / 0.25f));
-        *g = 255;
-        *b = (uint8_t)(255 * (1.0f - (normalized - 0.5f) / 0.25f));
-    } else {
-        *r = 255;
-        *g = (uint8_t)(255 * (1.0f - (normalized - 0.75f) / 0.25f));
-        *b = 0;
+thermal_status_t thermal_apply_colormap(const float *frame, const thermal_resolution_t *resolution, float min_temp, float max_temp, rgb565_t *output) {
+    if (!resolution) {
+        return THERMAL_ERR_INVALID_ARG;
     }
+    
+    thermal_rect_t full = { 0, 0, resolution->width, resolution->height };
+    return thermal_apply_colormap_region(frame, resolution, min_temp, max_temp, output, &full);
 }
 
-thermal_status_t thermal_apply_colormap(const float *frame, const thermal_resolution_t *resolution, float min_temp, float max_temp, rgb565_t *output) {
-    if (!frame || !resolution || !output) {
+thermal_status_t thermal_apply_colormap_region(const float *frame, const thermal_resolution_t *resolution, float min_temp, float max_temp, rgb565_t *output, const thermal_rect_t *region) {
+    if (!frame || !resolution || !output || !region) {
         return THERMAL_ERR_INVALID_ARG;
     }
     
@@ -219,14 +515,133 @@ thermal_status_t thermal_apply_colormap(const float *frame, const thermal_resolu
         return THERMAL_ERR_INVALID_ARG;
     }
     
-    size_t total_pixels = resolution->width * resolution->height;
+    if (!region_valid(resolution, region)) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
     
-    for (size_t i = 0; i < total_pixels; i++) {
-        uint8_t r, g, b;
-        temperature_to_rgb(frame[i], min_temp, max_temp, &r, &g, &b);
-        output[i] = RGB565(r, g, b);
+    THERMAL_TRACE_BEGIN(THERMAL_STAGE_COLORMAP);
+    
+    const thermal_simd_ops_t *simd = thermal_simd_ops();
+    
+    for (uint16_t y = region->y; y < region->y + region->height; y++) {
+        size_t start = (size_t)y * resolution->width + region->x;
+        simd->colormap(frame + start, region->width, min_temp, max_temp, output + start);
     }
     
+    THERMAL_TRACE_END(THERMAL_STAGE_COLORMAP);
+    return THERMAL_OK;
+}
+
+/* Per-frame kernel results are staged on the stack in chunks this size. */
+#define BATCH_CHUNK 16
+
+thermal_status_t thermal_find_minmax_batch(const float *frames, const thermal_resolution_t *resolution, size_t count, thermal_minmax_t *results) {
+    if (!frames || !resolution || !results || count == 0) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    size_t total_pixels = (size_t)resolution->width * resolution->height;
+    if (total_pixels == 0) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    const thermal_simd_ops_t *simd = vector_ops();
+    if (!simd) {
+        const geometry_kernels_t *kernels = find_geometry_kernels(resolution);
+        for (size_t f = 0; f < count; f++) {
+            const float *frame = frames + f * total_pixels;
+            if (kernels) {
+                kernels->minmax(frame, &results[f]);
+            } else {
+                minmax_core(frame, resolution->width, resolution->height, &results[f]);
+            }
+        }
+        return THERMAL_OK;
+    }
+
+    /* Frames share vector lanes, so tiny frames such as 8x8 keep every lane busy without horizontal reductions. */
+    for (size_t base = 0; base < count; base += BATCH_CHUNK) {
+        size_t n = count - base < BATCH_CHUNK ? count - base : BATCH_CHUNK;
+        float min_values[BATCH_CHUNK];
+        float max_values[BATCH_CHUNK];
+        size_t min_indices[BATCH_CHUNK];
+        size_t max_indices[BATCH_CHUNK];
+
+        simd->minmax_batch(frames + base * total_pixels, total_pixels, n, min_values, min_indices, max_values, max_indices);
+
+        for (size_t k = 0; k < n; k++) {
+            thermal_minmax_t *result = &results[base + k];
+            result->min_temp = min_values[k];
+            result->max_temp = max_values[k];
+            result->min_x = (uint16_t)(min_indices[k] % resolution->width);
+            result->min_y = (uint16_t)(min_indices[k] / resolution->width);
+            result->max_x = (uint16_t)(max_indices[k] % resolution->width);
+            result->max_y = (uint16_t)(max_indices[k] / resolution->width);
+        }
+    }
+
+    return THERMAL_OK;
+}
+
+thermal_status_t thermal_find_hotspots_batch(const float *frames, const thermal_resolution_t *resolution, size_t count, float threshold, thermal_hotspot_t *hotspots, size_t max_spots, size_t *found) {
+    if (!frames || !resolution || !hotspots || !found || count == 0 || max_spots == 0) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    size_t total_pixels = (size_t)resolution->width * resolution->height;
+    if (total_pixels == 0) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    const geometry_kernels_t *kernels = find_geometry_kernels(resolution);
+    for (size_t f = 0; f < count; f++) {
+        const float *frame = frames + f * total_pixels;
+        thermal_hotspot_t *spots = hotspots + f * max_spots;
+        if (kernels) {
+            found[f] = kernels->hotspots(frame, threshold, spots, max_spots);
+        } else {
+            found[f] = hotspots_core(frame, resolution->width, resolution->height, threshold, spots, max_spots);
+        }
+    }
+
+    return THERMAL_OK;
+}
+
+thermal_status_t thermal_apply_colormap_batch(const float *frames, const thermal_resolution_t *resolution, size_t count, float min_temp, float max_temp, const thermal_minmax_t *ranges, rgb565_t *output) {
+    if (!frames || !resolution || !output || count == 0) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    size_t total_pixels = (size_t)resolution->width * resolution->height;
+    if (total_pixels == 0) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    if (!ranges && min_temp >= max_temp) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    THERMAL_TRACE_BEGIN(THERMAL_STAGE_COLORMAP);
+
+    const thermal_simd_ops_t *simd = thermal_simd_ops();
+
+    /* A shared range makes the whole batch one contiguous kernel call. */
+    if (!ranges) {
+        simd->colormap(frames, total_pixels * count, min_temp, max_temp, output);
+    } else {
+        for (size_t f = 0; f < count; f++) {
+            float lo = ranges[f].min_temp;
+            float hi = ranges[f].max_temp;
+
+            /* A uniform frame has min == max; widen it so the frame maps to palette entry 0 instead of failing the batch. */
+            if (!(lo < hi)) {
+                hi = lo + 1.0f;
+            }
+            simd->colormap(frames + f * total_pixels, total_pixels, lo, hi, output + f * total_pixels);
+        }
+    }
+
+    THERMAL_TRACE_END(THERMAL_STAGE_COLORMAP);
     return THERMAL_OK;
 }
 
@@ -0,0 +1,288 @@
+#include "thermal_pyramid.h"
+#include <string.h>
+
+static thermal_resolution_t half_resolution(thermal_resolution_t res) {
+    thermal_resolution_t half = { (uint16_t)((res.width + 1) / 2), (uint16_t)((res.height + 1) / 2) };
+    return half;
+}
+
+size_t thermal_pyramid_buffer_size(const thermal_resolution_t *base, uint8_t level_count) {
+    if (!base || base->width == 0 || base->height == 0 || level_count == 0 || level_count > THERMAL_PYRAMID_MAX_LEVELS) {
+        return 0;
+    }
+
+    thermal_resolution_t res = *base;
+    size_t total = 0;
+
+    for (uint8_t i = 0; i < level_count; i++) {
+        if (res.width == 1 && res.height == 1) {
+            return 0;
+        }
+        res = half_resolution(res);
+        total += (size_t)res.width * res.height;
+    }
+
+    return total;
+}
+
+thermal_status_t thermal_pyramid_init(thermal_pyramid_t *pyramid, const thermal_resolution_t *base, const thermal_reduce_t *reduce, uint8_t level_count, float *buffer, size_t buffer_len) {
+    if (!pyramid || !reduce || !buffer) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    size_t required = thermal_pyramid_buffer_size(base, level_count);
+    if (required == 0 || buffer_len < required) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    memset(pyramid, 0, sizeof(*pyramid));
+    pyramid->base = *base;
+    pyramid->level_count = level_count;
+
+    thermal_resolution_t res = *base;
+    uint8_t max_chain = 1;
+
+    for (uint8_t i = 0; i < level_count; i++) {
+        if (reduce[i] > THERMAL_REDUCE_MIN) {
+            return THERMAL_ERR_INVALID_ARG;
+        }
+
+        res = half_resolution(res);
+        pyramid->levels[i].data = buffer;
+        pyramid->levels[i].resolution = res;
+        pyramid->levels[i].reduce = reduce[i];
+        buffer += (size_t)res.width * res.height;
+
+        /* Only an unbroken run of max levels from the bottom bounds the frame's own pixels. */
+        if (max_chain && reduce[i] == THERMAL_REDUCE_MAX) {
+            pyramid->max_levels++;
+        } else {
+            max_chain = 0;
+        }
+    }
+
+    return THERMAL_OK;
+}
+
+#define REDUCE_MEAN(a, b, c, d) (((a) + (b) + (c) + (d)) * 0.25f)
+#define REDUCE_MAX2(a, b) ((a) > (b) ? (a) : (b))
+#define REDUCE_MIN2(a, b) ((a) < (b) ? (a) : (b))
+#define REDUCE_MAX(a, b, c, d) REDUCE_MAX2(REDUCE_MAX2(a, b), REDUCE_MAX2(c, d))
+#define REDUCE_MIN(a, b, c, d) REDUCE_MIN2(REDUCE_MIN2(a, b), REDUCE_MIN2(c, d))
+
+/*
+ * A missing odd row or column reuses the last one, which leaves max and min unchanged and weights the mean
+ * over the pixels that exist.
+ */
+#define REDUCE_LEVEL(OP) \
+    for (uint16_t y = 0; y < dst_height; y++) { \
+        const float *r0 = src + (size_t)(2 * y) * src_width; \
+        const float *r1 = (2 * y + 1 < src_height) ? r0 + src_width : r0; \
+        float *out = dst + (size_t)y * dst_width; \
+        uint16_t x = 0; \
+        for (; x < pairs; x++) { \
+            out[x] = OP(r0[2 * x], r0[2 * x + 1], r1[2 * x], r1[2 * x + 1]); \
+        } \
+        if (x < dst_width) { \
+            out[x] = OP(r0[2 * x], r0[2 * x], r1[2 * x], r1[2 * x]); \
+        } \
+    }
+
+static void reduce_level(const float *src, uint16_t src_width, uint16_t src_height, float *dst, uint16_t dst_width, uint16_t dst_height, thermal_reduce_t reduce) {
+    uint16_t pairs = src_width / 2;
+
+    switch (reduce) {
+        case THERMAL_REDUCE_MAX:
+            REDUCE_LEVEL(REDUCE_MAX)
+            break;
+        case THERMAL_REDUCE_MIN:
+            REDUCE_LEVEL(REDUCE_MIN)
+            break;
+        default:
+            REDUCE_LEVEL(REDUCE_MEAN)
+            break;
+    }
+}
+
+thermal_status_t thermal_pyramid_build(thermal_pyramid_t *pyramid, const thermal_frame_t *frame) {
+    if (!pyramid || !frame || !frame->data || pyramid->level_count == 0) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    if (frame->resolution.width != pyramid->base.width || frame->resolution.height != pyramid->base.height) {
+        return THERMAL_ERR_FRAME_INVALID;
+    }
+
+    pyramid->frame = frame->data;
+
+    const float *src = frame->data;
+    thermal_resolution_t src_res = pyramid->base;
+
+    for (uint8_t i = 0; i < pyramid->level_count; i++) {
+        thermal_pyramid_level_t *level = &pyramid->levels[i];
+        reduce_level(src, src_res.width, src_res.height, level->data, level->resolution.width, level->resolution.height, level->reduce);
+        src = level->data;
+        src_res = level->resolution;
+    }
+
+    return THERMAL_OK;
+}
+
+typedef struct {
+    const thermal_pyramid_t *pyramid;
+    float threshold;
+    uint16_t y;
+    thermal_hotspot_t *hotspots;
+    size_t max_spots;
+    size_t found;
+} pyramid_scan_t;
+
+/* Same test as thermal_find_hotspots(): no neighbour strictly hotter, out-of-frame neighbours ignored. */
+static uint8_t is_local_max(const float *frame, uint16_t width, uint16_t height, uint16_t x, uint16_t y, float temp) {
+    uint16_t x0 = x > 0 ? x - 1 : x;
+    uint16_t x1 = x + 1 < width ? x + 1 : x;
+    uint16_t y0 = y > 0 ? y - 1 : y;
+    uint16_t y1 = y + 1 < height ? y + 1 : y;
+
+    for (uint16_t ny = y0; ny <= y1; ny++) {
+        const float *row = frame + (size_t)ny * width;
+        for (uint16_t nx = x0; nx <= x1; nx++) {
+            if (row[nx] > temp) {
+                return 0;
+            }
+        }
+    }
+
+    return 1;
+}
+
+/*
+ * Visits the cells under (level, cx) left to right on row scan->y, descending only into blocks whose maximum
+ * reaches the threshold. With no hotspot buffer it just counts pixels at or above the threshold.
+ * Returns nonzero once the hotspot buffer is full.
+ */
+static int scan_block(pyramid_scan_t *scan, int level, uint16_t cx) {
+    const thermal_pyramid_t *pyramid = scan->pyramid;
+
+    if (level < 0) {
+        uint16_t width = pyramid->base.width;
+        if (cx >= width) {
+            return 0;
+        }
+
+        float temp = pyramid->frame[(size_t)scan->y * width + cx];
+        if (!(temp >= scan->threshold)) {
+            return 0;
+        }
+
+        if (!scan->hotspots) {
+            scan->found++;
+            return 0;
+        }
+
+        if (!is_local_max(pyramid->frame, width, pyramid->base.height, cx, scan->y, temp)) {
+            return 0;
+        }
+
+        thermal_hotspot_t *spot = &scan->hotspots[scan->found];
+        spot->x = cx;
+        spot->y = scan->y;
+        spot->temperature = temp;
+        return ++scan->found == scan->max_spots;
+    }
+
+    const thermal_pyramid_level_t *cell_level = &pyramid->levels[level];
+    if (cx >= cell_level->resolution.width) {
+        return 0;
+    }
+
+    float block_max = cell_level->data[(size_t)(scan->y >> (level + 1)) * cell_level->resolution.width + cx];
+    if (!(block_max >= scan->threshold)) {
+        return 0;
+    }
+
+    return scan_block(scan, level - 1, (uint16_t)(2 * cx)) || scan_block(scan, level - 1, (uint16_t)(2 * cx + 1));
+}
+
+static void scan_rows(pyramid_scan_t *scan) {
+    const thermal_pyramid_t *pyramid = scan->pyramid;
+    int top = pyramid->max_levels - 1;
+    const thermal_pyramid_level_t *top_level = &pyramid->levels[top];
+    uint16_t top_width = top_level->resolution.width;
+    uint32_t block = 1u << (top + 1);
+
+    for (uint32_t y = 0; y < pyramid->base.height; y++) {
+        /* A whole block row below threshold is skipped in one step. */
+        if ((y & (block - 1)) == 0) {
+            const float *top_row = top_level->data + (size_t)(y >> (top + 1)) * top_width;
+            uint16_t bx = 0;
+            while (bx < top_width && !(top_row[bx] >= scan->threshold)) {
+                bx++;
+            }
+            if (bx == top_width) {
+                y += block - 1;
+                continue;
+            }
+        }
+
+        scan->y = (uint16_t)y;
+        for (uint16_t bx = 0; bx < top_width; bx++) {
+            if (scan_block(scan, top, bx)) {
+                return;
+            }
+        }
+    }
+}
+
+thermal_status_t thermal_pyramid_find_hotspots(const thermal_pyramid_t *pyramid, float threshold, thermal_hotspot_t *hotspots, size_t max_spots, size_t *found) {
+    if (!pyramid || !hotspots || !found || max_spots == 0) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    *found = 0;
+    if (!pyramid->frame) {
+        return THERMAL_ERR_NOT_INIT;
+    }
+
+    if (pyramid->max_levels == 0) {
+        return thermal_find_hotspots(pyramid->frame, &pyramid->base, threshold, hotspots, max_spots, found);
+    }
+
+    pyramid_scan_t scan = { pyramid, threshold, 0, hotspots, max_spots, 0 };
+    scan_rows(&scan);
+    *found = scan.found;
+
+    return THERMAL_OK;
+}
+
+thermal_status_t thermal_pyramid_count_above(const thermal_pyramid_t *pyramid, float threshold, size_t *count) {
+    if (!pyramid || !count) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    *count = 0;
+    if (!pyramid->frame) {
+        return THERMAL_ERR_NOT_INIT;
+    }
+
+    if (pyramid->max_levels == 0) {
+        size_t total_pixels = (size_t)pyramid->base.width * pyramid->base.height;
+        size_t total = 0;
+        for (size_t i = 0; i < total_pixels; i++) {
+            total += pyramid->frame[i] >= threshold;
+        }
+        *count = total;
+        return THERMAL_OK;
+    }
+
+    pyramid_scan_t scan = { pyramid, threshold, 0, NULL, 0, 0 };
+    scan_rows(&scan);
+    *count = scan.found;
+
+    return THERMAL_OK;
+}
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
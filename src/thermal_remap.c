@@ -0,0 +1,280 @@
+#include "thermal_remap.h"
+#include <math.h>
+#include <string.h>
+
+static int needs_table(const thermal_remap_config_t *config) {
+    return config->k1 != 0.0f || config->k2 != 0.0f || config->homography != NULL;
+}
+
+static thermal_status_t validate_config(const thermal_remap_config_t *config, const thermal_resolution_t *src_res) {
+    if (!config || !src_res || config->rotation > THERMAL_ROTATE_270) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    if (src_res->width == 0 || src_res->height == 0) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    /* Bilinear taps need a right and a lower neighbour. */
+    if (needs_table(config) && (src_res->width < 2 || src_res->height < 2)) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    return THERMAL_OK;
+}
+
+thermal_status_t thermal_remap_table_size(const thermal_remap_config_t *config, const thermal_resolution_t *src_res, size_t *tap_count) {
+    thermal_status_t status = validate_config(config, src_res);
+    if (status != THERMAL_OK) {
+        return status;
+    }
+
+    if (!tap_count) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    *tap_count = needs_table(config) ? (size_t)src_res->width * src_res->height : 0;
+    return THERMAL_OK;
+}
+
+/*
+ * Folds flips and rotation into one output-to-source mapping: the source column comes from the output column
+ * (or row, when transposed), optionally reversed, and likewise for the source row.
+ */
+static void resolve_orientation(const thermal_remap_config_t *config, thermal_remap_t *remap) {
+    uint8_t fh = config->flip_horizontal ? 1 : 0;
+    uint8_t fv = config->flip_vertical ? 1 : 0;
+
+    switch (config->rotation) {
+        case THERMAL_ROTATE_90: remap->transpose = 1; remap->reverse_x = fh; remap->reverse_y = !fv; break;
+        case THERMAL_ROTATE_180: remap->transpose = 0; remap->reverse_x = !fh; remap->reverse_y = !fv; break;
+        case THERMAL_ROTATE_270: remap->transpose = 1; remap->reverse_x = !fh; remap->reverse_y = fv; break;
+        default: remap->transpose = 0; remap->reverse_x = fh; remap->reverse_y = fv; break;
+    }
+
+    remap->dst_res = remap->src_res;
+    if (remap->transpose) {
+        remap->dst_res.width = remap->src_res.height;
+        remap->dst_res.height = remap->src_res.width;
+    }
+}
+
+static void build_taps(thermal_remap_t *remap, const thermal_remap_config_t *config) {
+    float w = (float)remap->src_res.width;
+    float h = (float)remap->src_res.height;
+    float cx = (w - 1.0f) * 0.5f;
+    float cy = (h - 1.0f) * 0.5f;
+    float norm = sqrtf(w * w + h * h) * 0.5f;
+    const float *m = config->homography;
+    thermal_remap_tap_t *tap = remap->taps;
+
+    for (uint16_t v = 0; v < remap->dst_res.height; v++) {
+        for (uint16_t u = 0; u < remap->dst_res.width; u++, tap++) {
+            float x = (float)u;
+            float y = (float)v;
+
+            if (m) {
+                float hw = m[6] * x + m[7] * y + m[8];
+                if (fabsf(hw) < 1e-6f) {
+                    tap->index = THERMAL_REMAP_NO_SOURCE;
+                    continue;
+                }
+                float hx = (m[0] * x + m[1] * y + m[2]) / hw;
+                float hy = (m[3] * x + m[4] * y + m[5]) / hw;
+                x = hx;
+                y = hy;
+            }
+
+            float tx = remap->transpose ? y : x;
+            float ty = remap->transpose ? x : y;
+            float sx = remap->reverse_x ? (w - 1.0f) - tx : tx;
+            float sy = remap->reverse_y ? (h - 1.0f) - ty : ty;
+
+            /* The Brown model maps undistorted to distorted positions directly, so no inversion is needed. */
+            float nx = (sx - cx) / norm;
+            float ny = (sy - cy) / norm;
+            float r2 = nx * nx + ny * ny;
+            float scale = 1.0f + config->k1 * r2 + config->k2 * r2 * r2;
+            sx = cx + nx * scale * norm;
+            sy = cy + ny * scale * norm;
+
+            if (!(sx >= -0.5f && sx <= w - 0.5f && sy >= -0.5f && sy <= h - 0.5f)) {
+                tap->index = THERMAL_REMAP_NO_SOURCE;
+                continue;
+            }
+
+            sx = sx < 0.0f ? 0.0f : (sx > w - 1.0f ? w - 1.0f : sx);
+            sy = sy < 0.0f ? 0.0f : (sy > h - 1.0f ? h - 1.0f : sy);
+
+            uint16_t x0 = (uint16_t)sx;
+            uint16_t y0 = (uint16_t)sy;
+            if (x0 > remap->src_res.width - 2) x0 = remap->src_res.width - 2;
+            if (y0 > remap->src_res.height - 2) y0 = remap->src_res.height - 2;
+
+            tap->index = (uint32_t)y0 * remap->src_res.width + x0;
+            tap->fx = sx - x0;
+            tap->fy = sy - y0;
+        }
+    }
+}
+
+thermal_status_t thermal_remap_init(thermal_remap_t *remap, const thermal_remap_config_t *config, const thermal_resolution_t *src_res, float fill_value, thermal_remap_tap_t *taps, size_t tap_capacity) {
+    size_t needed_taps;
+    thermal_status_t status = thermal_remap_table_size(config, src_res, &needed_taps);
+    if (status != THERMAL_OK) {
+        return status;
+    }
+
+    if (!remap || (needed_taps && (!taps || tap_capacity < needed_taps))) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    memset(remap, 0, sizeof(*remap));
+    remap->src_res = *src_res;
+    remap->fill_value = fill_value;
+    resolve_orientation(config, remap);
+
+    if (needed_taps) {
+        remap->taps = taps;
+        build_taps(remap, config);
+    }
+
+    return THERMAL_OK;
+}
+
+/* Mirrors rows and/or columns; every read of a row pair happens before its writes, so src may equal dst. */
+static void flip_frame(const float *src, float *dst, uint16_t width, uint16_t height, uint8_t reverse_x, uint8_t reverse_y) {
+    uint16_t rows = reverse_y ? (uint16_t)((height + 1) / 2) : height;
+
+    for (uint16_t y = 0; y < rows; y++) {
+        uint16_t yb = reverse_y ? (uint16_t)(height - 1 - y) : y;
+        const float *src_a = src + (size_t)y * width;
+        const float *src_b = src + (size_t)yb * width;
+        float *dst_a = dst + (size_t)y * width;
+        float *dst_b = dst + (size_t)yb * width;
+
+        if (reverse_x) {
+            for (uint16_t x = 0; x < (width + 1) / 2; x++) {
+                uint16_t xb = (uint16_t)(width - 1 - x);
+                float a0 = src_a[x], a1 = src_a[xb];
+                float b0 = src_b[x], b1 = src_b[xb];
+                dst_a[x] = b1;
+                dst_a[xb] = b0;
+                dst_b[x] = a1;
+                dst_b[xb] = a0;
+            }
+        } else if (yb != y) {
+            for (uint16_t x = 0; x < width; x++) {
+                float a = src_a[x];
+                dst_a[x] = src_b[x];
+                dst_b[x] = a;
+            }
+        } else if (dst_a != src_a) {
+            memcpy(dst_a, src_a, (size_t)width * sizeof(float));
+        }
+    }
+}
+
+/* Square in-place transpose, swapping whole blocks across the diagonal so both sides stay cache-resident. */
+static void transpose_square_in_place(float *data, uint16_t n) {
+    for (uint16_t bi = 0; bi < n; bi += THERMAL_REMAP_BLOCK_SIZE) {
+        uint16_t i_end = (uint16_t)(bi + THERMAL_REMAP_BLOCK_SIZE < n ? bi + THERMAL_REMAP_BLOCK_SIZE : n);
+
+        for (uint16_t bj = bi; bj < n; bj += THERMAL_REMAP_BLOCK_SIZE) {
+            uint16_t j_end = (uint16_t)(bj + THERMAL_REMAP_BLOCK_SIZE < n ? bj + THERMAL_REMAP_BLOCK_SIZE : n);
+
+            for (uint16_t i = bi; i < i_end; i++) {
+                for (uint16_t j = (bj == bi ? i + 1 : bj); j < j_end; j++) {
+                    float t = data[(size_t)i * n + j];
+                    data[(size_t)i * n + j] = data[(size_t)j * n + i];
+                    data[(size_t)j * n + i] = t;
+                }
+            }
+        }
+    }
+}
+
+/* dst(u, v) = src(sx(v), sy(u)), walked in blocks so the column-order reads of src stay in cache. */
+static void transpose_blocked(const thermal_remap_t *remap, const float *src, float *dst) {
+    uint16_t src_width = remap->src_res.width;
+    uint16_t src_height = remap->src_res.height;
+    uint16_t dst_width = remap->dst_res.width;
+    uint16_t dst_height = remap->dst_res.height;
+
+    for (uint16_t bv = 0; bv < dst_height; bv += THERMAL_REMAP_BLOCK_SIZE) {
+        uint16_t v_end = (uint16_t)(bv + THERMAL_REMAP_BLOCK_SIZE < dst_height ? bv + THERMAL_REMAP_BLOCK_SIZE : dst_height);
+
+        for (uint16_t bu = 0; bu < dst_width; bu += THERMAL_REMAP_BLOCK_SIZE) {
+            uint16_t u_end = (uint16_t)(bu + THERMAL_REMAP_BLOCK_SIZE < dst_width ? bu + THERMAL_REMAP_BLOCK_SIZE : dst_width);
+
+            for (uint16_t v = bv; v < v_end; v++) {
+                uint16_t sx = remap->reverse_x ? (uint16_t)(src_width - 1 - v) : v;
+                float *out = dst + (size_t)v * dst_width;
+
+                for (uint16_t u = bu; u < u_end; u++) {
+                    uint16_t sy = remap->reverse_y ? (uint16_t)(src_height - 1 - u) : u;
+                    out[u] = src[(size_t)sy * src_width + sx];
+                }
+            }
+        }
+    }
+}
+
+static void gather(const thermal_remap_t *remap, const float *src, float *dst) {
+    size_t total_pixels = (size_t)remap->dst_res.width * remap->dst_res.height;
+    uint16_t stride = remap->src_res.width;
+    const thermal_remap_tap_t *taps = remap->taps;
+
+    for (size_t i = 0; i < total_pixels; i++) {
+        if (taps[i].index == THERMAL_REMAP_NO_SOURCE) {
+            dst[i] = remap->fill_value;
+            continue;
+        }
+
+        const float *p = src + taps[i].index;
+        float top = p[0] + taps[i].fx * (p[1] - p[0]);
+        float bottom = p[stride] + taps[i].fx * (p[stride + 1] - p[stride]);
+        dst[i] = top + taps[i].fy * (bottom - top);
+    }
+}
+
+thermal_status_t thermal_remap_apply(const thermal_remap_t *remap, const thermal_frame_t *src, thermal_frame_t *dst) {
+    if (!remap || !src || !src->data || !dst || !dst->data) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    if (src->resolution.width != remap->src_res.width || src->resolution.height != remap->src_res.height) {
+        return THERMAL_ERR_FRAME_INVALID;
+    }
+
+    uint8_t in_place = src->data == dst->data;
+
+    if (remap->taps) {
+        if (in_place) {
+            return THERMAL_ERR_INVALID_ARG;
+        }
+        gather(remap, src->data, dst->data);
+    } else if (!remap->transpose) {
+        flip_frame(src->data, dst->data, remap->src_res.width, remap->src_res.height, remap->reverse_x, remap->reverse_y);
+    } else if (in_place) {
+        /* Transposed output: source columns become rows, so the column flip now applies to rows and vice versa. */
+        if (remap->src_res.width != remap->src_res.height) {
+            return THERMAL_ERR_INVALID_ARG;
+        }
+        transpose_square_in_place(dst->data, remap->src_res.width);
+        flip_frame(dst->data, dst->data, remap->dst_res.width, remap->dst_res.height, remap->reverse_y, remap->reverse_x);
+    } else {
+        transpose_blocked(remap, src->data, dst->data);
+    }
+
+    dst->resolution = remap->dst_res;
+    dst->timestamp = src->timestamp;
+    dst->unchanged = src->unchanged;
+
+    return THERMAL_OK;
+}
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
@@ -0,0 +1,159 @@
+#include "thermal_render.h"
+#include "thermal_processing.h"
+#include "thermal_trace.h"
+#include <string.h>
+
+#define RENDER_CHUNK 64
+
+thermal_status_t thermal_palette_init(thermal_palette_t *palette, thermal_pixel_format_t format) {
+    if (!palette || format > THERMAL_PIXEL_ARGB8888) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    memset(palette, 0, sizeof(*palette));
+    palette->format = format;
+
+    for (int i = 0; i < THERMAL_PALETTE_SIZE; i++) {
+        uint8_t r, g, b;
+        thermal_colormap_rgb((float)i, 0.0f, (float)(THERMAL_PALETTE_SIZE - 1), &r, &g, &b);
+        uint8_t *color = palette->colors[i];
+
+        switch (format) {
+            case THERMAL_PIXEL_RGB565_LE:
+            case THERMAL_PIXEL_RGB565_BE: {
+                rgb565_t pixel = RGB565(r, g, b);
+                uint8_t hi = (uint8_t)(pixel >> 8);
+                uint8_t lo = (uint8_t)pixel;
+                color[0] = format == THERMAL_PIXEL_RGB565_BE ? hi : lo;
+                color[1] = format == THERMAL_PIXEL_RGB565_BE ? lo : hi;
+                palette->bytes_per_pixel = 2;
+                break;
+            }
+            case THERMAL_PIXEL_RGB888:
+                color[0] = r;
+                color[1] = g;
+                color[2] = b;
+                palette->bytes_per_pixel = 3;
+                break;
+            default: {
+                uint32_t pixel = 0xFF000000u | ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+                memcpy(color, &pixel, sizeof(pixel));
+                palette->bytes_per_pixel = 4;
+                break;
+            }
+        }
+    }
+
+    return THERMAL_OK;
+}
+
+static inline uint8_t palette_index(float temp, float min_temp, float scale) {
+    float pos = (temp - min_temp) * scale + 0.5f;
+    if (!(pos > 0.0f)) {
+        return 0;
+    }
+    if (pos >= (float)(THERMAL_PALETTE_SIZE - 1)) {
+        return THERMAL_PALETTE_SIZE - 1;
+    }
+    return (uint8_t)pos;
+}
+
+/* Fixed-size copies compile to single stores; the switch sits outside the pixel loop. */
+static void write_pixels(uint8_t *out, const thermal_palette_t *palette, const uint8_t *indices, uint16_t count) {
+    switch (palette->bytes_per_pixel) {
+        case 2:
+            for (uint16_t i = 0; i < count; i++, out += 2) {
+                memcpy(out, palette->colors[indices[i]], 2);
+            }
+            break;
+        case 3:
+            for (uint16_t i = 0; i < count; i++, out += 3) {
+                memcpy(out, palette->colors[indices[i]], 3);
+            }
+            break;
+        default:
+            for (uint16_t i = 0; i < count; i++, out += 4) {
+                memcpy(out, palette->colors[indices[i]], 4);
+            }
+            break;
+    }
+}
+
+thermal_status_t thermal_render(const thermal_frame_t *frame, const thermal_palette_t *palette, float min_temp, float max_temp, thermal_scale_t scale, const thermal_framebuffer_t *framebuffer, const thermal_rect_t *dest) {
+    if (!frame || !frame->data || !palette || !framebuffer || !framebuffer->pixels) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    if (min_temp >= max_temp || scale > THERMAL_SCALE_BILINEAR || palette->format != framebuffer->format) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    uint16_t src_width = frame->resolution.width;
+    uint16_t src_height = frame->resolution.height;
+    if (src_width == 0 || src_height == 0) {
+        return THERMAL_ERR_FRAME_INVALID;
+    }
+
+    thermal_rect_t full = { 0, 0, framebuffer->width, framebuffer->height };
+    if (!dest) {
+        dest = &full;
+    }
+
+    if (dest->width == 0 || dest->height == 0 ||
+        (uint32_t)dest->x + dest->width > framebuffer->width ||
+        (uint32_t)dest->y + dest->height > framebuffer->height ||
+        framebuffer->stride < (size_t)framebuffer->width * palette->bytes_per_pixel) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    THERMAL_TRACE_BEGIN(THERMAL_STAGE_COLORMAP);
+
+    /* Corner-aligned like thermal_interpolate_bilinear(), so both scalers agree on where source pixels land. */
+    float x_ratio = dest->width > 1 ? (float)(src_width - 1) / (float)(dest->width - 1) : 0.0f;
+    float y_ratio = dest->height > 1 ? (float)(src_height - 1) / (float)(dest->height - 1) : 0.0f;
+    float index_scale = (float)(THERMAL_PALETTE_SIZE - 1) / (max_temp - min_temp);
+    const float *src = frame->data;
+    uint8_t *base = (uint8_t *)framebuffer->pixels + (size_t)dest->y * framebuffer->stride + (size_t)dest->x * palette->bytes_per_pixel;
+    uint8_t indices[RENDER_CHUNK];
+
+    for (uint16_t v = 0; v < dest->height; v++) {
+        float src_y = v * y_ratio;
+        uint16_t y0 = (uint16_t)src_y;
+        uint16_t y1 = (y0 + 1 < src_height) ? y0 + 1 : y0;
+        float dy = src_y - y0;
+        const float *row0 = src + (size_t)(scale == THERMAL_SCALE_NEAREST ? (uint16_t)(src_y + 0.5f) : y0) * src_width;
+        const float *row1 = src + (size_t)y1 * src_width;
+        uint8_t *out = base + (size_t)v * framebuffer->stride;
+
+        for (uint16_t u0 = 0; u0 < dest->width; u0 += RENDER_CHUNK) {
+            uint16_t count = (uint16_t)(dest->width - u0 < RENDER_CHUNK ? dest->width - u0 : RENDER_CHUNK);
+
+            if (scale == THERMAL_SCALE_NEAREST) {
+                for (uint16_t i = 0; i < count; i++) {
+                    uint16_t x = (uint16_t)((u0 + i) * x_ratio + 0.5f);
+                    indices[i] = palette_index(row0[x], min_temp, index_scale);
+                }
+            } else {
+                for (uint16_t i = 0; i < count; i++) {
+                    float src_x = (u0 + i) * x_ratio;
+                    uint16_t x0 = (uint16_t)src_x;
+                    uint16_t x1 = (x0 + 1 < src_width) ? x0 + 1 : x0;
+                    float dx = src_x - x0;
+                    float r1 = row0[x0] * (1.0f - dx) + row0[x1] * dx;
+                    float r2 = row1[x0] * (1.0f - dx) + row1[x1] * dx;
+                    indices[i] = palette_index(r1 * (1.0f - dy) + r2 * dy, min_temp, index_scale);
+                }
+            }
+
+            write_pixels(out + (size_t)u0 * palette->bytes_per_pixel, palette, indices, count);
+        }
+    }
+
+    THERMAL_TRACE_END(THERMAL_STAGE_COLORMAP);
+    return THERMAL_OK;
+}
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
@@ -0,0 +1,250 @@
+#include "thermal_scheduler.h"
+#include "thermal_log.h"
+#include <string.h>
+
+#define SCHED_NO_ENTRY 0xFF
+
+/* Only the entry's bus thread writes its stats; each update is bracketed so readers never see it half done. */
+static void stats_write_begin(thermal_sched_entry_t *entry) {
+    uint32_t sequence = atomic_load_explicit(&entry->stats_sequence, memory_order_relaxed);
+    atomic_store_explicit(&entry->stats_sequence, sequence + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+}
+
+static void stats_write_end(thermal_sched_entry_t *entry) {
+    uint32_t sequence = atomic_load_explicit(&entry->stats_sequence, memory_order_relaxed);
+    platform_atomic_store(&entry->stats_sequence, sequence + 1);
+}
+
+thermal_status_t thermal_scheduler_init(thermal_scheduler_t *sched) {
+    if (!sched) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    memset(sched, 0, sizeof(*sched));
+    atomic_init(&sched->running, 0);
+
+    return THERMAL_OK;
+}
+
+static thermal_sched_bus_t *find_or_add_bus(thermal_scheduler_t *sched, void *hw_handle) {
+    for (uint8_t i = 0; i < sched->bus_count; i++) {
+        if (sched->buses[i].hw_handle == hw_handle) {
+            return &sched->buses[i];
+        }
+    }
+
+    if (sched->bus_count >= THERMAL_SCHED_MAX_BUSES) {
+        return NULL;
+    }
+
+    thermal_sched_bus_t *bus = &sched->buses[sched->bus_count];
+    bus->owner = sched;
+    bus->hw_handle = hw_handle;
+    bus->index = sched->bus_count;
+    bus->member_count = 0;
+    sched->bus_count++;
+
+    return bus;
+}
+
+thermal_status_t thermal_scheduler_add(thermal_scheduler_t *sched, thermal_device_t *device, float *buffer, size_t buf_len, thermal_sched_frame_fn on_frame, void *ctx, uint8_t *entry_index) {
+    if (!sched || !device || !buffer) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    if (!device->initialized) {
+        return THERMAL_ERR_NOT_INIT;
+    }
+
+    if (device->refresh_rate_hz == 0 || sched->entry_count >= THERMAL_SCHED_MAX_DEVICES) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    if (buf_len < (size_t)device->resolution.width * device->resolution.height) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    if (platform_atomic_load(&sched->running)) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    /* Devices on the same physical bus are read one at a time. */
+    void *bus_handle = device->transport->bus ? device->transport->bus : device->transport->hw_handle;
+    thermal_sched_bus_t *bus = find_or_add_bus(sched, bus_handle);
+    if (!bus) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    uint8_t index = sched->entry_count++;
+    thermal_sched_entry_t *entry = &sched->entries[index];
+
+    memset(entry, 0, sizeof(*entry));
+    atomic_init(&entry->stats_sequence, 0);
+    entry->device = device;
+    entry->frame.data = buffer;
+    entry->frame.resolution = device->resolution;
+    entry->on_frame = on_frame;
+    entry->ctx = ctx;
+    entry->period_us = 1000000U / device->refresh_rate_hz;
+    entry->release_us = platform_time_us();
+    entry->bus = bus->index;
+
+    bus->members[bus->member_count++] = index;
+
+    if (entry_index) {
+        *entry_index = index;
+    }
+
+    return THERMAL_OK;
+}
+
+thermal_status_t thermal_scheduler_poll(thermal_scheduler_t *sched, uint8_t bus_index) {
+    if (!sched || bus_index >= sched->bus_count) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    thermal_sched_bus_t *bus = &sched->buses[bus_index];
+    uint64_t now = platform_time_us();
+    uint64_t wake_us = now + THERMAL_SCHED_MAX_SLEEP_US;
+    uint64_t best_deadline = UINT64_MAX;
+    uint8_t best = SCHED_NO_ENTRY;
+
+    /* Earliest deadline first among released frames; a frame's deadline is when the next one replaces it. */
+    for (uint8_t i = 0; i < bus->member_count; i++) {
+        thermal_sched_entry_t *entry = &sched->entries[bus->members[i]];
+
+        if (entry->release_us <= now) {
+            uint64_t deadline = entry->release_us + entry->period_us;
+            if (deadline < best_deadline) {
+                best_deadline = deadline;
+                best = bus->members[i];
+            }
+        } else if (entry->release_us < wake_us) {
+            wake_us = entry->release_us;
+        }
+    }
+
+    if (best == SCHED_NO_ENTRY) {
+        platform_sleep_until_us(wake_us);
+        return THERMAL_OK;
+    }
+
+    thermal_sched_entry_t *entry = &sched->entries[best];
+
+    if (now >= best_deadline) {
+        uint64_t missed = (now - entry->release_us) / entry->period_us;
+        stats_write_begin(entry);
+        entry->stats.skipped += (uint32_t)missed;
+        stats_write_end(entry);
+        entry->release_us += missed * entry->period_us;
+    }
+
+    uint32_t lateness = (uint32_t)(now - entry->release_us);
+    entry->release_us += entry->period_us;
+
+    thermal_status_t status = thermal_get_frame(entry->device, &entry->frame);
+    if (status != THERMAL_OK) {
+        stats_write_begin(entry);
+        entry->stats.errors++;
+        stats_write_end(entry);
+        THERMAL_LOG_WARN("Scheduler: read failed on bus %u, entry %u\n", bus_index, best);
+        return status;
+    }
+
+    stats_write_begin(entry);
+    entry->stats.frames++;
+    entry->stats.last_lateness_us = lateness;
+    entry->stats.total_lateness_us += lateness;
+    if (lateness > entry->stats.max_lateness_us) {
+        entry->stats.max_lateness_us = lateness;
+    }
+    stats_write_end(entry);
+
+    if (entry->on_frame) {
+        entry->on_frame(entry->device, &entry->frame, entry->ctx);
+    }
+
+    return THERMAL_OK;
+}
+
+static void bus_worker(void *arg) {
+    thermal_sched_bus_t *bus = (thermal_sched_bus_t *)arg;
+
+    while (platform_atomic_load(&bus->owner->running)) {
+        thermal_scheduler_poll(bus->owner, bus->index);
+    }
+}
+
+thermal_status_t thermal_scheduler_start(thermal_scheduler_t *sched) {
+    if (!sched || sched->bus_count == 0) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    if (platform_atomic_load(&sched->running)) {
+        return THERMAL_OK;
+    }
+
+    uint64_t now = platform_time_us();
+    for (uint8_t i = 0; i < sched->entry_count; i++) {
+        sched->entries[i].release_us = now;
+    }
+
+    platform_atomic_store(&sched->running, 1);
+
+    for (uint8_t i = 0; i < sched->bus_count; i++) {
+        if (platform_thread_create(&sched->buses[i].thread, bus_worker, &sched->buses[i]) != 0) {
+            platform_atomic_store(&sched->running, 0);
+            for (uint8_t j = 0; j < i; j++) {
+                platform_thread_join(&sched->buses[j].thread);
+            }
+            return THERMAL_ERR_UNSUPPORTED;
+        }
+    }
+
+    return THERMAL_OK;
+}
+
+thermal_status_t thermal_scheduler_stop(thermal_scheduler_t *sched) {
+    if (!sched) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    if (!platform_atomic_load(&sched->running)) {
+        return THERMAL_OK;
+    }
+
+    platform_atomic_store(&sched->running, 0);
+    for (uint8_t i = 0; i < sched->bus_count; i++) {
+        platform_thread_join(&sched->buses[i].thread);
+    }
+
+    return THERMAL_OK;
+}
+
+thermal_status_t thermal_scheduler_get_stats(thermal_scheduler_t *sched, uint8_t entry_index, thermal_sched_stats_t *stats) {
+    if (!sched || !stats || entry_index >= sched->entry_count) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    thermal_sched_entry_t *entry = &sched->entries[entry_index];
+
+    /* Retry while the bus thread is mid-update; sleeping lets a preempted writer finish on a single core. */
+    for (;;) {
+        uint32_t sequence = platform_atomic_load(&entry->stats_sequence);
+        if (!(sequence & 1u)) {
+            *stats = entry->stats;
+            atomic_thread_fence(memory_order_acquire);
+            if (atomic_load_explicit(&entry->stats_sequence, memory_order_relaxed) == sequence) {
+                return THERMAL_OK;
+            }
+        }
+
+        platform_sleep_us(1);
+    }
+}
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
@@ -0,0 +1,347 @@
+#include "thermal_simd.h"
+#include "thermal_processing.h"
+#include "thermal_log.h"
+#include "platform/platform_hal.h"
+#include <float.h>
+#include <math.h>
+#include <string.h>
+
+#define SELF_CHECK_LEN 67
+#define SELF_CHECK_FRAMES 9
+#define DECODE_TOLERANCE 0.001f
+
+/* Scalar kernels define the expected results; the SIMD versions are checked against them. */
+
+static void minmax_scalar(const float *data, size_t count, float *min_value, size_t *min_index, float *max_value, size_t *max_index) {
+    float min_temp = FLT_MAX;
+    float max_temp = -FLT_MAX;
+    size_t min_i = 0;
+    size_t max_i = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        float temp = data[i];
+
+        if (temp < min_temp) {
+            min_temp = temp;
+            min_i = i;
+        }
+
+        if (temp > max_temp) {
+            max_temp = temp;
+            max_i = i;
+        }
+    }
+
+    *min_value = min_temp;
+    *min_index = min_i;
+    *max_value = max_temp;
+    *max_index = max_i;
+}
+
+static void minmax_batch_scalar(const float *frames, size_t pixels, size_t count, float *min_values, size_t *min_indices, float *max_values, size_t *max_indices) {
+    for (size_t f = 0; f < count; f++) {
+        minmax_scalar(frames + f * pixels, pixels, &min_values[f], &min_indices[f], &max_values[f], &max_indices[f]);
+    }
+}
+
+static void temperature_to_rgb(float temp, float min_temp, float max_temp, uint8_t *r, uint8_t *g, uint8_t *b) {
+    float normalized = (temp - min_temp) / (max_temp - min_temp);
+    if (normalized < 0.0f) normalized = 0.0f;
+    if (normalized > 1.0f) normalized = 1.0f;
+    
+    if (normalized < 0.25f) {
+        *r = 0;
+        *g = 0;
+        *b = (uint8_t)(255 * (normalized / 0.25f));
+    } else if (normalized < 0.5f) {
+        *r = 0;
+        *g = (uint8_t)(255 * ((normalized - 0.25f) / 0.25f));
+        *b = 255;
+    } else if (normalized < 0.75f) {
+        *r = (uint8_t)(255 * ((normalized - 0.5f) / 0.25f));
+        *g = 255;
+        *b = (uint8_t)(255 * (1.0f - (normalized - 0.5f) / 0.25f));
+    } else {
+        *r = 255;
+        *g = (uint8_t)(255 * (1.0f - (normalized - 0.75f) / 0.25f));
+        *b = 0;
+    }
+}
+
+void thermal_colormap_rgb(float temp, float min_temp, float max_temp, uint8_t *r, uint8_t *g, uint8_t *b) {
+    temperature_to_rgb(temp, min_temp, max_temp, r, g, b);
+}
+
+static void colormap_scalar(const float *src, size_t count, float min_temp, float max_temp, rgb565_t *dst) {
+    for (size_t i = 0; i < count; i++) {
+        uint8_t r, g, b;
+        temperature_to_rgb(src[i], min_temp, max_temp, &r, &g, &b);
+        dst[i] = RGB565(r, g, b);
+    }
+}
+
+static void bilinear_row_scalar(const float *row1, const float *row2, uint16_t src_width, float x_ratio, float dy, uint16_t x_start, uint16_t x_end, float *out) {
+    for (uint16_t x = x_start; x < x_end; x++) {
+        float src_x = x * x_ratio;
+        uint16_t x1 = (uint16_t)src_x;
+        uint16_t x2 = (x1 + 1 < src_width) ? x1 + 1 : x1;
+        float dx = src_x - x1;
+
+        float r1 = row1[x1] * (1.0f - dx) + row1[x2] * dx;
+        float r2 = row2[x1] * (1.0f - dx) + row2[x2] * dx;
+        out[x] = r1 * (1.0f - dy) + r2 * dy;
+    }
+}
+
+#define SORT2(a, b) do { float lo_ = (a) < (b) ? (a) : (b); (b) = (a) < (b) ? (b) : (a); (a) = lo_; } while (0)
+
+static void median3_row_scalar(const float *up, const float *row, const float *down, uint16_t x_start, uint16_t x_end, float *out) {
+    for (uint16_t x = x_start; x < x_end; x++) {
+        float p[9] = {
+            up[x - 1], up[x], up[x + 1],
+            row[x - 1], row[x], row[x + 1],
+            down[x - 1], down[x], down[x + 1]
+        };
+
+        SORT2(p[1], p[2]); SORT2(p[4], p[5]); SORT2(p[7], p[8]);
+        SORT2(p[0], p[1]); SORT2(p[3], p[4]); SORT2(p[6], p[7]);
+        SORT2(p[1], p[2]); SORT2(p[4], p[5]); SORT2(p[7], p[8]);
+        SORT2(p[0], p[3]); SORT2(p[5], p[8]); SORT2(p[4], p[7]);
+        SORT2(p[3], p[6]); SORT2(p[1], p[4]); SORT2(p[2], p[5]);
+        SORT2(p[4], p[7]); SORT2(p[4], p[2]); SORT2(p[6], p[4]);
+        SORT2(p[4], p[2]);
+        out[x] = p[4];
+    }
+}
+
+static void ir_decode_scalar(const uint16_t *raw, const uint16_t *alpha, const int16_t *offset, const float *kta, const float *kv, float ta, float vdd, size_t count, float *out) {
+    for (size_t i = 0; i < count; i++) {
+        float alpha_comp = ((float)alpha[i]) / 65536.0f;
+        float offset_comp = (float)offset[i];
+        
+        float vir = (float)raw[i];
+        float vir_comp = vir - offset_comp * (1.0f + kta[i] * (ta - 25.0f)) * (1.0f + kv[i] * (vdd - 3.3f));
+        
+        float sx = alpha_comp * vir_comp;
+        
+        if (sx <= 0.0f) {
+            sx = 1.0f;
+        }
+        
+        float temp_k = powf((sx / 5.67e-8f), 0.25f);
+        out[i] = temp_k - 273.15f;
+    }
+}
+
+static void threshold_bits_scalar(const float *src, size_t count, float threshold, uint64_t *bits) {
+    for (size_t i = 0; i < count; i += 64) {
+        size_t n = count - i < 64 ? count - i : 64;
+        uint64_t word = 0;
+        for (size_t b = 0; b < n; b++) {
+            word |= (uint64_t)(src[i + b] >= threshold) << b;
+        }
+        bits[i / 64] = word;
+    }
+}
+
+static const thermal_simd_ops_t scalar_ops = {
+    .level = THERMAL_SIMD_SCALAR,
+    .name = "scalar",
+    .minmax = minmax_scalar,
+    .colormap = colormap_scalar,
+    .bilinear_row = bilinear_row_scalar,
+    .median3_row = median3_row_scalar,
+    .ir_decode = ir_decode_scalar,
+    .threshold_bits = threshold_bits_scalar,
+    .minmax_batch = minmax_batch_scalar
+};
+
+static const thermal_simd_ops_t *level_ops(thermal_simd_level_t level) {
+    switch (level) {
+        case THERMAL_SIMD_SCALAR: return &scalar_ops;
+#ifdef THERMAL_SIMD_X86
+        case THERMAL_SIMD_SSE41: return &thermal_simd_sse41_ops;
+        case THERMAL_SIMD_AVX2: return &thermal_simd_avx2_ops;
+#endif
+#ifdef THERMAL_SIMD_ARM_NEON
+        case THERMAL_SIMD_NEON: return &thermal_simd_neon_ops;
+#endif
+        default: return NULL;
+    }
+}
+
+/* Stores level + 1 so zero means "not yet initialized". */
+static platform_atomic_u32_t active_level;
+
+uint8_t thermal_simd_supported(thermal_simd_level_t level) {
+    if (!level_ops(level)) {
+        return 0;
+    }
+
+    switch (level) {
+#ifdef THERMAL_SIMD_X86
+        case THERMAL_SIMD_SSE41:
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("sse4.1") ? 1 : 0;
+        case THERMAL_SIMD_AVX2:
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2") ? 1 : 0;
+#endif
+        default:
+            return 1;
+    }
+}
+
+/* Deterministic inputs with ties, signed zeros and out-of-range values to exercise every branch. */
+static void fill_test_data(float *data, size_t count, uint32_t seed) {
+    uint32_t state = seed;
+    for (size_t i = 0; i < count; i++) {
+        state = state * 1664525u + 1013904223u;
+        int32_t v = (int32_t)((state >> 8) % 1200) - 200;
+        data[i] = (v == 0) ? -0.0f : (float)v / 16.0f;
+    }
+}
+
+static thermal_status_t check_kernels(const thermal_simd_ops_t *ops) {
+    float a[SELF_CHECK_LEN + 2];
+    float b[SELF_CHECK_LEN + 2];
+    float c[SELF_CHECK_LEN + 2];
+    float expected[SELF_CHECK_LEN + 2];
+    float actual[SELF_CHECK_LEN + 2];
+    rgb565_t expected_rgb[SELF_CHECK_LEN];
+    rgb565_t actual_rgb[SELF_CHECK_LEN];
+
+    fill_test_data(a, SELF_CHECK_LEN + 2, 1);
+    fill_test_data(b, SELF_CHECK_LEN + 2, 2);
+    fill_test_data(c, SELF_CHECK_LEN + 2, 3);
+
+    /* Every length up to SELF_CHECK_LEN covers all vector-body/tail splits. */
+    for (size_t len = 1; len <= SELF_CHECK_LEN; len++) {
+        float e_min, e_max, a_min, a_max;
+        size_t e_min_i, e_max_i, a_min_i, a_max_i;
+
+        scalar_ops.minmax(a, len, &e_min, &e_min_i, &e_max, &e_max_i);
+        ops->minmax(a, len, &a_min, &a_min_i, &a_max, &a_max_i);
+        if (memcmp(&e_min, &a_min, sizeof(float)) != 0 || memcmp(&e_max, &a_max, sizeof(float)) != 0 ||
+            e_min_i != a_min_i || e_max_i != a_max_i) {
+            THERMAL_LOG_ERROR("SIMD: %s minmax mismatch at length %u\n", ops->name, (unsigned)len);
+            return THERMAL_ERR_CHECKSUM;
+        }
+
+        scalar_ops.colormap(a, len, -5.0f, 50.0f, expected_rgb);
+        ops->colormap(a, len, -5.0f, 50.0f, actual_rgb);
+        if (memcmp(expected_rgb, actual_rgb, len * sizeof(rgb565_t)) != 0) {
+            THERMAL_LOG_ERROR("SIMD: %s colormap mismatch at length %u\n", ops->name, (unsigned)len);
+            return THERMAL_ERR_CHECKSUM;
+        }
+
+        uint16_t width = (uint16_t)(len + 1);
+        uint16_t dst_width = (uint16_t)(len * 3 + 1);
+        float x_ratio = (float)(width - 1) / (float)(dst_width - 1);
+        float wide_expected[SELF_CHECK_LEN * 3 + 1];
+        float wide_actual[SELF_CHECK_LEN * 3 + 1];
+        scalar_ops.bilinear_row(a, b, width, x_ratio, 0.375f, 1, dst_width, wide_expected);
+        ops->bilinear_row(a, b, width, x_ratio, 0.375f, 1, dst_width, wide_actual);
+        if (memcmp(wide_expected + 1, wide_actual + 1, (size_t)(dst_width - 1) * sizeof(float)) != 0) {
+            THERMAL_LOG_ERROR("SIMD: %s bilinear mismatch at length %u\n", ops->name, (unsigned)len);
+            return THERMAL_ERR_CHECKSUM;
+        }
+
+        scalar_ops.median3_row(a, b, c, 1, (uint16_t)(len + 1), expected);
+        ops->median3_row(a, b, c, 1, (uint16_t)(len + 1), actual);
+        if (memcmp(expected + 1, actual + 1, len * sizeof(float)) != 0) {
+            THERMAL_LOG_ERROR("SIMD: %s median mismatch at length %u\n", ops->name, (unsigned)len);
+            return THERMAL_ERR_CHECKSUM;
+        }
+
+        uint64_t expected_bits[(SELF_CHECK_LEN + 63) / 64];
+        uint64_t actual_bits[(SELF_CHECK_LEN + 63) / 64];
+        scalar_ops.threshold_bits(a, len, 0.5f, expected_bits);
+        ops->threshold_bits(a, len, 0.5f, actual_bits);
+        if (memcmp(expected_bits, actual_bits, (len + 63) / 64 * sizeof(uint64_t)) != 0) {
+            THERMAL_LOG_ERROR("SIMD: %s threshold mismatch at length %u\n", ops->name, (unsigned)len);
+            return THERMAL_ERR_CHECKSUM;
+        }
+
+        /* Frames overlap the test data back to back; short lengths fill whole 4- and 8-lane groups. */
+        size_t frames = (SELF_CHECK_LEN + 2) / len < SELF_CHECK_FRAMES ? (SELF_CHECK_LEN + 2) / len : SELF_CHECK_FRAMES;
+        float e_mins[SELF_CHECK_FRAMES], e_maxs[SELF_CHECK_FRAMES], a_mins[SELF_CHECK_FRAMES], a_maxs[SELF_CHECK_FRAMES];
+        size_t e_min_is[SELF_CHECK_FRAMES], e_max_is[SELF_CHECK_FRAMES], a_min_is[SELF_CHECK_FRAMES], a_max_is[SELF_CHECK_FRAMES];
+        scalar_ops.minmax_batch(a, len, frames, e_mins, e_min_is, e_maxs, e_max_is);
+        ops->minmax_batch(a, len, frames, a_mins, a_min_is, a_maxs, a_max_is);
+        if (memcmp(e_mins, a_mins, frames * sizeof(float)) != 0 || memcmp(e_maxs, a_maxs, frames * sizeof(float)) != 0 ||
+            memcmp(e_min_is, a_min_is, frames * sizeof(size_t)) != 0 || memcmp(e_max_is, a_max_is, frames * sizeof(size_t)) != 0) {
+            THERMAL_LOG_ERROR("SIMD: %s batch minmax mismatch at length %u\n", ops->name, (unsigned)len);
+            return THERMAL_ERR_CHECKSUM;
+        }
+
+        uint16_t raw[SELF_CHECK_LEN];
+        uint16_t alpha[SELF_CHECK_LEN];
+        int16_t offset[SELF_CHECK_LEN];
+        for (size_t i = 0; i < len; i++) {
+            raw[i] = (uint16_t)(30000 + (int)(a[i] * 64.0f));
+            alpha[i] = (uint16_t)(64 + i % 32);
+            offset[i] = (int16_t)(b[i] * 8.0f);
+        }
+        scalar_ops.ir_decode(raw, alpha, offset, b, c, 31.5f, 3.25f, len, expected);
+        ops->ir_decode(raw, alpha, offset, b, c, 31.5f, 3.25f, len, actual);
+        for (size_t i = 0; i < len; i++) {
+            if (!(fabsf(expected[i] - actual[i]) <= DECODE_TOLERANCE)) {
+                THERMAL_LOG_ERROR("SIMD: %s decode mismatch at length %u\n", ops->name, (unsigned)len);
+                return THERMAL_ERR_CHECKSUM;
+            }
+        }
+    }
+
+    return THERMAL_OK;
+}
+
+thermal_status_t thermal_simd_self_check(thermal_simd_level_t level) {
+    if (!thermal_simd_supported(level)) {
+        return THERMAL_ERR_UNSUPPORTED;
+    }
+
+    return check_kernels(level_ops(level));
+}
+
+thermal_status_t thermal_simd_select(thermal_simd_level_t level) {
+    if (!thermal_simd_supported(level)) {
+        return THERMAL_ERR_UNSUPPORTED;
+    }
+
+    platform_atomic_store(&active_level, (uint32_t)level + 1);
+    return THERMAL_OK;
+}
+
+thermal_simd_level_t thermal_simd_init(void) {
+    static const thermal_simd_level_t preference[] = {
+        THERMAL_SIMD_AVX2, THERMAL_SIMD_NEON, THERMAL_SIMD_SSE41
+    };
+    thermal_simd_level_t chosen = THERMAL_SIMD_SCALAR;
+
+    for (size_t i = 0; i < sizeof(preference) / sizeof(preference[0]); i++) {
+        if (thermal_simd_self_check(preference[i]) == THERMAL_OK) {
+            chosen = preference[i];
+            break;
+        }
+    }
+
+    platform_atomic_store(&active_level, (uint32_t)chosen + 1);
+    THERMAL_LOG_INFO("SIMD: using %s kernels\n", level_ops(chosen)->name);
+
+    return chosen;
+}
+
+const thermal_simd_ops_t *thermal_simd_ops(void) {
+    uint32_t level = platform_atomic_load(&active_level);
+    if (level == 0) {
+        level = (uint32_t)thermal_simd_init() + 1;
+    }
+
+    return level_ops((thermal_simd_level_t)(level - 1));
+}
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
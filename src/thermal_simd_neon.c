@@ -0,0 +1,341 @@
+#include "thermal_simd.h"
+
+#ifdef THERMAL_SIMD_ARM_NEON
+
+#include <arm_neon.h>
+#include <float.h>
+#include <math.h>
+
+/*
+ * NEON is architectural on AArch64, so there is nothing to detect. Compare-
+ * exchanges use compare+select rather than vminq/vmaxq, whose NaN propagation
+ * differs from the scalar a < b ? a : b. Multiplies and adds stay separate so
+ * results round like the scalar code.
+ */
+
+static size_t find_first_neon(const float *data, size_t count, float value, size_t *index) {
+    float32x4_t target = vdupq_n_f32(value);
+    size_t i = 0;
+
+    for (; i + 4 <= count; i += 4) {
+        uint32x4_t eq = vceqq_f32(vld1q_f32(data + i), target);
+        if (vmaxvq_u32(eq)) {
+            break;
+        }
+    }
+
+    for (; i < count; i++) {
+        if (data[i] == value) {
+            *index = i;
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+static void minmax_neon(const float *data, size_t count, float *min_value, size_t *min_index, float *max_value, size_t *max_index) {
+    float32x4_t vmin = vdupq_n_f32(FLT_MAX);
+    float32x4_t vmax = vdupq_n_f32(-FLT_MAX);
+    size_t i = 0;
+
+    for (; i + 4 <= count; i += 4) {
+        float32x4_t v = vld1q_f32(data + i);
+        vmin = vbslq_f32(vcltq_f32(v, vmin), v, vmin);
+        vmax = vbslq_f32(vcgtq_f32(v, vmax), v, vmax);
+    }
+
+    float lanes_min[4], lanes_max[4];
+    vst1q_f32(lanes_min, vmin);
+    vst1q_f32(lanes_max, vmax);
+
+    float lo = FLT_MAX;
+    float hi = -FLT_MAX;
+    for (int l = 0; l < 4; l++) {
+        if (lanes_min[l] < lo) lo = lanes_min[l];
+        if (lanes_max[l] > hi) hi = lanes_max[l];
+    }
+    for (; i < count; i++) {
+        if (data[i] < lo) lo = data[i];
+        if (data[i] > hi) hi = data[i];
+    }
+
+    /* The scalar kernel keeps the first occurrence; report that element so -0/+0 ties match too. */
+    *min_index = 0;
+    *max_index = 0;
+    *min_value = find_first_neon(data, count, lo, min_index) ? data[*min_index] : FLT_MAX;
+    *max_value = find_first_neon(data, count, hi, max_index) ? data[*max_index] : -FLT_MAX;
+}
+
+static uint32x4_t colormap4_neon(float32x4_t t, float32x4_t vmin, float32x4_t range) {
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t four = vdupq_n_f32(4.0f);
+    const float32x4_t full = vdupq_n_f32(255.0f);
+
+    float32x4_t n = vdivq_f32(vsubq_f32(t, vmin), range);
+    n = vbslq_f32(vcltq_f32(n, zero), zero, n);
+    n = vbslq_f32(vcgtq_f32(n, one), one, n);
+
+    float32x4_t q0 = vmulq_f32(full, vmulq_f32(n, four));
+    float32x4_t q1 = vmulq_f32(full, vmulq_f32(vsubq_f32(n, vdupq_n_f32(0.25f)), four));
+    float32x4_t q2 = vmulq_f32(vsubq_f32(n, vdupq_n_f32(0.5f)), four);
+    float32x4_t q3 = vmulq_f32(full, vsubq_f32(one, vmulq_f32(vsubq_f32(n, vdupq_n_f32(0.75f)), four)));
+
+    uint32x4_t below1 = vcltq_f32(n, vdupq_n_f32(0.25f));
+    uint32x4_t below2 = vcltq_f32(n, vdupq_n_f32(0.5f));
+    uint32x4_t below3 = vcltq_f32(n, vdupq_n_f32(0.75f));
+
+    float32x4_t r = vbslq_f32(below3, vmulq_f32(full, q2), full);
+    r = vbslq_f32(below2, zero, r);
+
+    float32x4_t g = vbslq_f32(below3, full, q3);
+    g = vbslq_f32(below2, q1, g);
+    g = vbslq_f32(below1, zero, g);
+
+    float32x4_t b = vbslq_f32(below3, vmulq_f32(full, vsubq_f32(one, q2)), zero);
+    b = vbslq_f32(below2, full, b);
+    b = vbslq_f32(below1, q0, b);
+
+    uint32x4_t ri = vcvtq_u32_f32(r);
+    uint32x4_t gi = vcvtq_u32_f32(g);
+    uint32x4_t bi = vcvtq_u32_f32(b);
+
+    uint32x4_t rgb = vshlq_n_u32(vandq_u32(ri, vdupq_n_u32(0xF8)), 8);
+    rgb = vorrq_u32(rgb, vshlq_n_u32(vandq_u32(gi, vdupq_n_u32(0xFC)), 3));
+    return vorrq_u32(rgb, vshrq_n_u32(vandq_u32(bi, vdupq_n_u32(0xF8)), 3));
+}
+
+static void colormap_neon(const float *src, size_t count, float min_temp, float max_temp, rgb565_t *dst) {
+    float32x4_t vmin = vdupq_n_f32(min_temp);
+    float32x4_t range = vdupq_n_f32(max_temp - min_temp);
+    size_t i = 0;
+
+    for (; i + 4 <= count; i += 4) {
+        vst1_u16(dst + i, vmovn_u32(colormap4_neon(vld1q_f32(src + i), vmin, range)));
+    }
+
+    if (i < count) {
+        float tail[4] = { 0 };
+        rgb565_t out[4];
+        size_t n = count - i;
+        for (size_t k = 0; k < n; k++) tail[k] = src[i + k];
+        vst1_u16(out, vmovn_u32(colormap4_neon(vld1q_f32(tail), vmin, range)));
+        for (size_t k = 0; k < n; k++) dst[i + k] = out[k];
+    }
+}
+
+static void bilinear_row_neon(const float *row1, const float *row2, uint16_t src_width, float x_ratio, float dy, uint16_t x_start, uint16_t x_end, float *out) {
+    static const int32_t lane_offsets[4] = { 0, 1, 2, 3 };
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    float32x4_t ratio = vdupq_n_f32(x_ratio);
+    float32x4_t wy1 = vdupq_n_f32(1.0f - dy);
+    float32x4_t wy2 = vdupq_n_f32(dy);
+    int32x4_t last = vdupq_n_s32(src_width - 1);
+    uint32_t x = x_start;
+
+    for (; x + 4 <= x_end; x += 4) {
+        int32x4_t xs = vaddq_s32(vdupq_n_s32((int32_t)x), vld1q_s32(lane_offsets));
+        float32x4_t src_x = vmulq_f32(vcvtq_f32_s32(xs), ratio);
+        int32x4_t x1 = vcvtq_s32_f32(src_x);
+        int32x4_t x2 = vminq_s32(vaddq_s32(x1, vdupq_n_s32(1)), last);
+        float32x4_t dx = vsubq_f32(src_x, vcvtq_f32_s32(x1));
+        float32x4_t wx1 = vsubq_f32(one, dx);
+
+        int32_t i1[4], i2[4];
+        vst1q_s32(i1, x1);
+        vst1q_s32(i2, x2);
+
+        float q11_v[4] = { row1[i1[0]], row1[i1[1]], row1[i1[2]], row1[i1[3]] };
+        float q21_v[4] = { row1[i2[0]], row1[i2[1]], row1[i2[2]], row1[i2[3]] };
+        float q12_v[4] = { row2[i1[0]], row2[i1[1]], row2[i1[2]], row2[i1[3]] };
+        float q22_v[4] = { row2[i2[0]], row2[i2[1]], row2[i2[2]], row2[i2[3]] };
+
+        float32x4_t r1 = vaddq_f32(vmulq_f32(vld1q_f32(q11_v), wx1), vmulq_f32(vld1q_f32(q21_v), dx));
+        float32x4_t r2 = vaddq_f32(vmulq_f32(vld1q_f32(q12_v), wx1), vmulq_f32(vld1q_f32(q22_v), dx));
+        vst1q_f32(out + x, vaddq_f32(vmulq_f32(r1, wy1), vmulq_f32(r2, wy2)));
+    }
+
+    for (; x < x_end; x++) {
+        float src_x = x * x_ratio;
+        uint16_t x1 = (uint16_t)src_x;
+        uint16_t x2 = (x1 + 1 < src_width) ? x1 + 1 : x1;
+        float dx = src_x - x1;
+
+        float r1 = row1[x1] * (1.0f - dx) + row1[x2] * dx;
+        float r2 = row2[x1] * (1.0f - dx) + row2[x2] * dx;
+        out[x] = r1 * (1.0f - dy) + r2 * dy;
+    }
+}
+
+#define SORT2_NEON(a, b) do { \
+    uint32x4_t lt_ = vcltq_f32((a), (b)); \
+    float32x4_t lo_ = vbslq_f32(lt_, (a), (b)); \
+    (b) = vbslq_f32(lt_, (b), (a)); \
+    (a) = lo_; \
+} while (0)
+
+static float32x4_t median9_neon(float32x4_t p0, float32x4_t p1, float32x4_t p2, float32x4_t p3, float32x4_t p4, float32x4_t p5, float32x4_t p6, float32x4_t p7, float32x4_t p8) {
+    SORT2_NEON(p1, p2); SORT2_NEON(p4, p5); SORT2_NEON(p7, p8);
+    SORT2_NEON(p0, p1); SORT2_NEON(p3, p4); SORT2_NEON(p6, p7);
+    SORT2_NEON(p1, p2); SORT2_NEON(p4, p5); SORT2_NEON(p7, p8);
+    SORT2_NEON(p0, p3); SORT2_NEON(p5, p8); SORT2_NEON(p4, p7);
+    SORT2_NEON(p3, p6); SORT2_NEON(p1, p4); SORT2_NEON(p2, p5);
+    SORT2_NEON(p4, p7); SORT2_NEON(p4, p2); SORT2_NEON(p6, p4);
+    SORT2_NEON(p4, p2);
+    return p4;
+}
+
+static void median3_row_neon(const float *up, const float *row, const float *down, uint16_t x_start, uint16_t x_end, float *out) {
+    uint32_t x = x_start;
+
+    for (; x + 4 <= x_end; x += 4) {
+        float32x4_t m = median9_neon(
+            vld1q_f32(up + x - 1), vld1q_f32(up + x), vld1q_f32(up + x + 1),
+            vld1q_f32(row + x - 1), vld1q_f32(row + x), vld1q_f32(row + x + 1),
+            vld1q_f32(down + x - 1), vld1q_f32(down + x), vld1q_f32(down + x + 1));
+        vst1q_f32(out + x, m);
+    }
+
+    for (; x < x_end; x++) {
+        float32x4_t m = median9_neon(
+            vdupq_n_f32(up[x - 1]), vdupq_n_f32(up[x]), vdupq_n_f32(up[x + 1]),
+            vdupq_n_f32(row[x - 1]), vdupq_n_f32(row[x]), vdupq_n_f32(row[x + 1]),
+            vdupq_n_f32(down[x - 1]), vdupq_n_f32(down[x]), vdupq_n_f32(down[x + 1]));
+        out[x] = vgetq_lane_f32(m, 0);
+    }
+}
+
+static void ir_decode_neon(const uint16_t *raw, const uint16_t *alpha, const int16_t *offset, const float *kta, const float *kv, float ta, float vdd, size_t count, float *out) {
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    float32x4_t ta_delta = vdupq_n_f32(ta - 25.0f);
+    float32x4_t vdd_delta = vdupq_n_f32(vdd - 3.3f);
+    size_t i = 0;
+
+    for (; i + 4 <= count; i += 4) {
+        float32x4_t vir = vcvtq_f32_u32(vmovl_u16(vld1_u16(raw + i)));
+        float32x4_t alpha_comp = vmulq_f32(vcvtq_f32_u32(vmovl_u16(vld1_u16(alpha + i))), vdupq_n_f32(1.0f / 65536.0f));
+        float32x4_t offset_comp = vcvtq_f32_s32(vmovl_s16(vld1_s16(offset + i)));
+
+        float32x4_t ta_term = vaddq_f32(one, vmulq_f32(vld1q_f32(kta + i), ta_delta));
+        float32x4_t vdd_term = vaddq_f32(one, vmulq_f32(vld1q_f32(kv + i), vdd_delta));
+        float32x4_t vir_comp = vsubq_f32(vir, vmulq_f32(vmulq_f32(offset_comp, ta_term), vdd_term));
+
+        float32x4_t sx = vmulq_f32(alpha_comp, vir_comp);
+        sx = vbslq_f32(vcleq_f32(sx, vdupq_n_f32(0.0f)), one, sx);
+
+        /* x^0.25 as two square roots; within an ulp or so of powf. */
+        float32x4_t temp_k = vsqrtq_f32(vsqrtq_f32(vdivq_f32(sx, vdupq_n_f32(5.67e-8f))));
+        vst1q_f32(out + i, vsubq_f32(temp_k, vdupq_n_f32(273.15f)));
+    }
+
+    for (; i < count; i++) {
+        float alpha_comp = ((float)alpha[i]) / 65536.0f;
+        float offset_comp = (float)offset[i];
+        float vir_comp = (float)raw[i] - offset_comp * (1.0f + kta[i] * (ta - 25.0f)) * (1.0f + kv[i] * (vdd - 3.3f));
+        float sx = alpha_comp * vir_comp;
+
+        if (sx <= 0.0f) {
+            sx = 1.0f;
+        }
+
+        out[i] = sqrtf(sqrtf(sx / 5.67e-8f)) - 273.15f;
+    }
+}
+
+static void threshold_bits_neon(const float *src, size_t count, float threshold, uint64_t *bits) {
+    static const uint32_t lane_bits[4] = { 1, 2, 4, 8 };
+    float32x4_t t = vdupq_n_f32(threshold);
+    uint32x4_t weights = vld1q_u32(lane_bits);
+
+    for (size_t i = 0; i < count; i += 64) {
+        size_t n = count - i < 64 ? count - i : 64;
+        uint64_t word = 0;
+        size_t b = 0;
+        for (; b + 4 <= n; b += 4) {
+            uint32x4_t ge = vcgeq_f32(vld1q_f32(src + i + b), t);
+            word |= (uint64_t)vaddvq_u32(vandq_u32(ge, weights)) << b;
+        }
+        for (; b < n; b++) {
+            word |= (uint64_t)(src[i + b] >= threshold) << b;
+        }
+        bits[i / 64] = word;
+    }
+}
+
+/* Lane l tracks frame l; strict compares keep the first occurrence, like the scalar kernel. */
+static inline void lanes_update_neon(float32x4_t v, uint32_t index, float32x4_t *vmin, uint32x4_t *imin, float32x4_t *vmax, uint32x4_t *imax) {
+    uint32x4_t vi = vdupq_n_u32(index);
+    uint32x4_t lt = vcltq_f32(v, *vmin);
+    uint32x4_t gt = vcgtq_f32(v, *vmax);
+    *vmin = vbslq_f32(lt, v, *vmin);
+    *imin = vbslq_u32(lt, vi, *imin);
+    *vmax = vbslq_f32(gt, v, *vmax);
+    *imax = vbslq_u32(gt, vi, *imax);
+}
+
+/* Four frames at a time: 4x4 blocks are transposed so each vector holds one pixel of every frame. */
+static void minmax_batch_neon(const float *frames, size_t pixels, size_t count, float *min_values, size_t *min_indices, float *max_values, size_t *max_indices) {
+    size_t f = 0;
+
+    for (; f + 4 <= count; f += 4) {
+        const float *p0 = frames + f * pixels;
+        const float *p1 = p0 + pixels;
+        const float *p2 = p1 + pixels;
+        const float *p3 = p2 + pixels;
+        float32x4_t vmin = vdupq_n_f32(FLT_MAX);
+        float32x4_t vmax = vdupq_n_f32(-FLT_MAX);
+        uint32x4_t imin = vdupq_n_u32(0);
+        uint32x4_t imax = vdupq_n_u32(0);
+        size_t i = 0;
+
+        for (; i + 4 <= pixels; i += 4) {
+            float32x4x2_t t01 = vtrnq_f32(vld1q_f32(p0 + i), vld1q_f32(p1 + i));
+            float32x4x2_t t23 = vtrnq_f32(vld1q_f32(p2 + i), vld1q_f32(p3 + i));
+            lanes_update_neon(vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0])), (uint32_t)i, &vmin, &imin, &vmax, &imax);
+            lanes_update_neon(vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1])), (uint32_t)i + 1, &vmin, &imin, &vmax, &imax);
+            lanes_update_neon(vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0])), (uint32_t)i + 2, &vmin, &imin, &vmax, &imax);
+            lanes_update_neon(vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1])), (uint32_t)i + 3, &vmin, &imin, &vmax, &imax);
+        }
+        for (; i < pixels; i++) {
+            float lane[4] = { p0[i], p1[i], p2[i], p3[i] };
+            lanes_update_neon(vld1q_f32(lane), (uint32_t)i, &vmin, &imin, &vmax, &imax);
+        }
+
+        float lo[4], hi[4];
+        uint32_t lo_i[4], hi_i[4];
+        vst1q_f32(lo, vmin);
+        vst1q_f32(hi, vmax);
+        vst1q_u32(lo_i, imin);
+        vst1q_u32(hi_i, imax);
+        for (int l = 0; l < 4; l++) {
+            min_values[f + l] = lo[l];
+            min_indices[f + l] = lo_i[l];
+            max_values[f + l] = hi[l];
+            max_indices[f + l] = hi_i[l];
+        }
+    }
+
+    for (; f < count; f++) {
+        minmax_neon(frames + f * pixels, pixels, &min_values[f], &min_indices[f], &max_values[f], &max_indices[f]);
+    }
+}
+
+const thermal_simd_ops_t thermal_simd_neon_ops = {
+    .level = THERMAL_SIMD_NEON,
+    .name = "neon",
+    .minmax = minmax_neon,
+    .colormap = colormap_neon,
+    .bilinear_row = bilinear_row_neon,
+    .median3_row = median3_row_neon,
+    .ir_decode = ir_decode_neon,
+    .threshold_bits = threshold_bits_neon,
+    .minmax_batch = minmax_batch_neon
+};
+
+#endif
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
@@ -0,0 +1,558 @@
+#include "thermal_simd.h"
+
+#ifdef THERMAL_SIMD_X86
+
+#include <immintrin.h>
+#include <float.h>
+
+/*
+ * Built for the baseline target; each kernel enables its own ISA so one binary
+ * carries every variant. MINPS/MAXPS are defined as a < b ? a : b and
+ * a > b ? a : b, which matches the scalar compare-exchange exactly, NaNs and
+ * signed zeros included. Multiplies and adds stay separate (no FMA) so results
+ * round like the scalar code.
+ */
+#define TARGET_SSE41 __attribute__((target("sse4.1")))
+#define TARGET_AVX2 __attribute__((target("avx2")))
+
+/* ---- SSE4.1 ---- */
+
+TARGET_SSE41 static size_t find_first_sse41(const float *data, size_t count, float value, size_t *index) {
+    __m128 target = _mm_set1_ps(value);
+    size_t i = 0;
+
+    for (; i + 4 <= count; i += 4) {
+        int mask = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(data + i), target));
+        if (mask) {
+            *index = i + (size_t)__builtin_ctz((unsigned)mask);
+            return 1;
+        }
+    }
+
+    for (; i < count; i++) {
+        if (data[i] == value) {
+            *index = i;
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+TARGET_SSE41 static void minmax_sse41(const float *data, size_t count, float *min_value, size_t *min_index, float *max_value, size_t *max_index) {
+    __m128 vmin = _mm_set1_ps(FLT_MAX);
+    __m128 vmax = _mm_set1_ps(-FLT_MAX);
+    size_t i = 0;
+
+    for (; i + 4 <= count; i += 4) {
+        __m128 v = _mm_loadu_ps(data + i);
+        vmin = _mm_min_ps(v, vmin);
+        vmax = _mm_max_ps(v, vmax);
+    }
+
+    float lanes_min[4], lanes_max[4];
+    _mm_storeu_ps(lanes_min, vmin);
+    _mm_storeu_ps(lanes_max, vmax);
+
+    float lo = FLT_MAX;
+    float hi = -FLT_MAX;
+    for (int l = 0; l < 4; l++) {
+        if (lanes_min[l] < lo) lo = lanes_min[l];
+        if (lanes_max[l] > hi) hi = lanes_max[l];
+    }
+    for (; i < count; i++) {
+        if (data[i] < lo) lo = data[i];
+        if (data[i] > hi) hi = data[i];
+    }
+
+    /* The scalar kernel keeps the first occurrence; report that element so -0/+0 ties match too. */
+    *min_index = 0;
+    *max_index = 0;
+    *min_value = find_first_sse41(data, count, lo, min_index) ? data[*min_index] : FLT_MAX;
+    *max_value = find_first_sse41(data, count, hi, max_index) ? data[*max_index] : -FLT_MAX;
+}
+
+TARGET_SSE41 static __m128i colormap4_sse41(__m128 t, __m128 vmin, __m128 range) {
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 four = _mm_set1_ps(4.0f);
+    const __m128 full = _mm_set1_ps(255.0f);
+
+    __m128 n = _mm_div_ps(_mm_sub_ps(t, vmin), range);
+    n = _mm_min_ps(_mm_max_ps(n, zero), one);
+
+    __m128 q0 = _mm_mul_ps(full, _mm_mul_ps(n, four));
+    __m128 q1 = _mm_mul_ps(full, _mm_mul_ps(_mm_sub_ps(n, _mm_set1_ps(0.25f)), four));
+    __m128 q2 = _mm_mul_ps(_mm_sub_ps(n, _mm_set1_ps(0.5f)), four);
+    __m128 q3 = _mm_mul_ps(full, _mm_sub_ps(one, _mm_mul_ps(_mm_sub_ps(n, _mm_set1_ps(0.75f)), four)));
+
+    __m128 below1 = _mm_cmplt_ps(n, _mm_set1_ps(0.25f));
+    __m128 below2 = _mm_cmplt_ps(n, _mm_set1_ps(0.5f));
+    __m128 below3 = _mm_cmplt_ps(n, _mm_set1_ps(0.75f));
+
+    __m128 r = _mm_blendv_ps(full, _mm_mul_ps(full, q2), below3);
+    r = _mm_blendv_ps(r, zero, below2);
+
+    __m128 g = _mm_blendv_ps(q3, full, below3);
+    g = _mm_blendv_ps(g, q1, below2);
+    g = _mm_blendv_ps(g, zero, below1);
+
+    __m128 b = _mm_blendv_ps(zero, _mm_mul_ps(full, _mm_sub_ps(one, q2)), below3);
+    b = _mm_blendv_ps(b, full, below2);
+    b = _mm_blendv_ps(b, q0, below1);
+
+    __m128i ri = _mm_cvttps_epi32(r);
+    __m128i gi = _mm_cvttps_epi32(g);
+    __m128i bi = _mm_cvttps_epi32(b);
+
+    __m128i rgb = _mm_slli_epi32(_mm_and_si128(ri, _mm_set1_epi32(0xF8)), 8);
+    rgb = _mm_or_si128(rgb, _mm_slli_epi32(_mm_and_si128(gi, _mm_set1_epi32(0xFC)), 3));
+    return _mm_or_si128(rgb, _mm_srli_epi32(_mm_and_si128(bi, _mm_set1_epi32(0xF8)), 3));
+}
+
+TARGET_SSE41 static void colormap_sse41(const float *src, size_t count, float min_temp, float max_temp, rgb565_t *dst) {
+    __m128 vmin = _mm_set1_ps(min_temp);
+    __m128 range = _mm_set1_ps(max_temp - min_temp);
+    size_t i = 0;
+
+    for (; i + 8 <= count; i += 8) {
+        __m128i lo = colormap4_sse41(_mm_loadu_ps(src + i), vmin, range);
+        __m128i hi = colormap4_sse41(_mm_loadu_ps(src + i + 4), vmin, range);
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_packus_epi32(lo, hi));
+    }
+
+    if (i < count) {
+        float tail[8] = { 0 };
+        rgb565_t out[8];
+        size_t n = count - i;
+        for (size_t k = 0; k < n; k++) tail[k] = src[i + k];
+        __m128i lo = colormap4_sse41(_mm_loadu_ps(tail), vmin, range);
+        __m128i hi = colormap4_sse41(_mm_loadu_ps(tail + 4), vmin, range);
+        _mm_storeu_si128((__m128i *)out, _mm_packus_epi32(lo, hi));
+        for (size_t k = 0; k < n; k++) dst[i + k] = out[k];
+    }
+}
+
+TARGET_SSE41 static void bilinear_row_sse41(const float *row1, const float *row2, uint16_t src_width, float x_ratio, float dy, uint16_t x_start, uint16_t x_end, float *out) {
+    const __m128 one = _mm_set1_ps(1.0f);
+    __m128 ratio = _mm_set1_ps(x_ratio);
+    __m128 wy1 = _mm_set1_ps(1.0f - dy);
+    __m128 wy2 = _mm_set1_ps(dy);
+    __m128i last = _mm_set1_epi32(src_width - 1);
+    uint32_t x = x_start;
+
+    for (; x + 4 <= x_end; x += 4) {
+        __m128i xs = _mm_add_epi32(_mm_set1_epi32((int)x), _mm_setr_epi32(0, 1, 2, 3));
+        __m128 src_x = _mm_mul_ps(_mm_cvtepi32_ps(xs), ratio);
+        __m128i x1 = _mm_cvttps_epi32(src_x);
+        __m128i x2 = _mm_min_epi32(_mm_add_epi32(x1, _mm_set1_epi32(1)), last);
+        __m128 dx = _mm_sub_ps(src_x, _mm_cvtepi32_ps(x1));
+        __m128 wx1 = _mm_sub_ps(one, dx);
+
+        int i1[4], i2[4];
+        _mm_storeu_si128((__m128i *)i1, x1);
+        _mm_storeu_si128((__m128i *)i2, x2);
+
+        __m128 q11 = _mm_setr_ps(row1[i1[0]], row1[i1[1]], row1[i1[2]], row1[i1[3]]);
+        __m128 q21 = _mm_setr_ps(row1[i2[0]], row1[i2[1]], row1[i2[2]], row1[i2[3]]);
+        __m128 q12 = _mm_setr_ps(row2[i1[0]], row2[i1[1]], row2[i1[2]], row2[i1[3]]);
+        __m128 q22 = _mm_setr_ps(row2[i2[0]], row2[i2[1]], row2[i2[2]], row2[i2[3]]);
+
+        __m128 r1 = _mm_add_ps(_mm_mul_ps(q11, wx1), _mm_mul_ps(q21, dx));
+        __m128 r2 = _mm_add_ps(_mm_mul_ps(q12, wx1), _mm_mul_ps(q22, dx));
+        _mm_storeu_ps(out + x, _mm_add_ps(_mm_mul_ps(r1, wy1), _mm_mul_ps(r2, wy2)));
+    }
+
+    for (; x < x_end; x++) {
+        float src_x = x * x_ratio;
+        uint16_t x1 = (uint16_t)src_x;
+        uint16_t x2 = (x1 + 1 < src_width) ? x1 + 1 : x1;
+        float dx = src_x - x1;
+
+        float r1 = row1[x1] * (1.0f - dx) + row1[x2] * dx;
+        float r2 = row2[x1] * (1.0f - dx) + row2[x2] * dx;
+        out[x] = r1 * (1.0f - dy) + r2 * dy;
+    }
+}
+
+#define SORT2_SSE(a, b) do { __m128 lo_ = _mm_min_ps((a), (b)); (b) = _mm_max_ps((b), (a)); (a) = lo_; } while (0)
+
+TARGET_SSE41 static __m128 median9_sse41(__m128 p0, __m128 p1, __m128 p2, __m128 p3, __m128 p4, __m128 p5, __m128 p6, __m128 p7, __m128 p8) {
+    SORT2_SSE(p1, p2); SORT2_SSE(p4, p5); SORT2_SSE(p7, p8);
+    SORT2_SSE(p0, p1); SORT2_SSE(p3, p4); SORT2_SSE(p6, p7);
+    SORT2_SSE(p1, p2); SORT2_SSE(p4, p5); SORT2_SSE(p7, p8);
+    SORT2_SSE(p0, p3); SORT2_SSE(p5, p8); SORT2_SSE(p4, p7);
+    SORT2_SSE(p3, p6); SORT2_SSE(p1, p4); SORT2_SSE(p2, p5);
+    SORT2_SSE(p4, p7); SORT2_SSE(p4, p2); SORT2_SSE(p6, p4);
+    SORT2_SSE(p4, p2);
+    return p4;
+}
+
+TARGET_SSE41 static void median3_row_sse41(const float *up, const float *row, const float *down, uint16_t x_start, uint16_t x_end, float *out) {
+    uint32_t x = x_start;
+
+    for (; x + 4 <= x_end; x += 4) {
+        __m128 m = median9_sse41(
+            _mm_loadu_ps(up + x - 1), _mm_loadu_ps(up + x), _mm_loadu_ps(up + x + 1),
+            _mm_loadu_ps(row + x - 1), _mm_loadu_ps(row + x), _mm_loadu_ps(row + x + 1),
+            _mm_loadu_ps(down + x - 1), _mm_loadu_ps(down + x), _mm_loadu_ps(down + x + 1));
+        _mm_storeu_ps(out + x, m);
+    }
+
+    for (; x < x_end; x++) {
+        __m128 m = median9_sse41(
+            _mm_set_ss(up[x - 1]), _mm_set_ss(up[x]), _mm_set_ss(up[x + 1]),
+            _mm_set_ss(row[x - 1]), _mm_set_ss(row[x]), _mm_set_ss(row[x + 1]),
+            _mm_set_ss(down[x - 1]), _mm_set_ss(down[x]), _mm_set_ss(down[x + 1]));
+        out[x] = _mm_cvtss_f32(m);
+    }
+}
+
+TARGET_SSE41 static __m128 ir_decode4_sse41(const uint16_t *raw, const uint16_t *alpha, const int16_t *offset, const float *kta, const float *kv, __m128 ta_delta, __m128 vdd_delta) {
+    const __m128 one = _mm_set1_ps(1.0f);
+
+    __m128 vir = _mm_cvtepi32_ps(_mm_cvtepu16_epi32(_mm_loadl_epi64((const __m128i *)raw)));
+    __m128 alpha_comp = _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu16_epi32(_mm_loadl_epi64((const __m128i *)alpha))), _mm_set1_ps(1.0f / 65536.0f));
+    __m128 offset_comp = _mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i *)offset)));
+
+    __m128 ta_term = _mm_add_ps(one, _mm_mul_ps(_mm_loadu_ps(kta), ta_delta));
+    __m128 vdd_term = _mm_add_ps(one, _mm_mul_ps(_mm_loadu_ps(kv), vdd_delta));
+    __m128 vir_comp = _mm_sub_ps(vir, _mm_mul_ps(_mm_mul_ps(offset_comp, ta_term), vdd_term));
+
+    __m128 sx = _mm_mul_ps(alpha_comp, vir_comp);
+    sx = _mm_blendv_ps(sx, one, _mm_cmple_ps(sx, _mm_setzero_ps()));
+
+    /* x^0.25 as two square roots; within an ulp or so of powf. */
+    __m128 temp_k = _mm_sqrt_ps(_mm_sqrt_ps(_mm_div_ps(sx, _mm_set1_ps(5.67e-8f))));
+    return _mm_sub_ps(temp_k, _mm_set1_ps(273.15f));
+}
+
+TARGET_SSE41 static void ir_decode_sse41(const uint16_t *raw, const uint16_t *alpha, const int16_t *offset, const float *kta, const float *kv, float ta, float vdd, size_t count, float *out) {
+    __m128 ta_delta = _mm_set1_ps(ta - 25.0f);
+    __m128 vdd_delta = _mm_set1_ps(vdd - 3.3f);
+    size_t i = 0;
+
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(out + i, ir_decode4_sse41(raw + i, alpha + i, offset + i, kta + i, kv + i, ta_delta, vdd_delta));
+    }
+
+    if (i < count) {
+        uint16_t raw_tail[4] = { 0 };
+        uint16_t alpha_tail[4] = { 0 };
+        int16_t offset_tail[4] = { 0 };
+        float kta_tail[4] = { 0 };
+        float kv_tail[4] = { 0 };
+        float result[4];
+        size_t n = count - i;
+
+        for (size_t k = 0; k < n; k++) {
+            raw_tail[k] = raw[i + k];
+            alpha_tail[k] = alpha[i + k];
+            offset_tail[k] = offset[i + k];
+            kta_tail[k] = kta[i + k];
+            kv_tail[k] = kv[i + k];
+        }
+
+        _mm_storeu_ps(result, ir_decode4_sse41(raw_tail, alpha_tail, offset_tail, kta_tail, kv_tail, ta_delta, vdd_delta));
+        for (size_t k = 0; k < n; k++) out[i + k] = result[k];
+    }
+}
+
+TARGET_SSE41 static void threshold_bits_sse41(const float *src, size_t count, float threshold, uint64_t *bits) {
+    __m128 t = _mm_set1_ps(threshold);
+
+    for (size_t i = 0; i < count; i += 64) {
+        size_t n = count - i < 64 ? count - i : 64;
+        uint64_t word = 0;
+        size_t b = 0;
+        for (; b + 4 <= n; b += 4) {
+            word |= (uint64_t)_mm_movemask_ps(_mm_cmpge_ps(_mm_loadu_ps(src + i + b), t)) << b;
+        }
+        for (; b < n; b++) {
+            word |= (uint64_t)(src[i + b] >= threshold) << b;
+        }
+        bits[i / 64] = word;
+    }
+}
+
+/* Lane l tracks frame l; strict compares keep the first occurrence, like the scalar kernel. */
+TARGET_SSE41 static inline void lanes_update_sse41(__m128 v, uint32_t index, __m128 *vmin, __m128i *imin, __m128 *vmax, __m128i *imax) {
+    __m128i vi = _mm_set1_epi32((int32_t)index);
+    __m128 lt = _mm_cmplt_ps(v, *vmin);
+    __m128 gt = _mm_cmpgt_ps(v, *vmax);
+    *vmin = _mm_blendv_ps(*vmin, v, lt);
+    *imin = _mm_blendv_epi8(*imin, vi, _mm_castps_si128(lt));
+    *vmax = _mm_blendv_ps(*vmax, v, gt);
+    *imax = _mm_blendv_epi8(*imax, vi, _mm_castps_si128(gt));
+}
+
+/* Four frames at a time: 4x4 blocks are transposed so each vector holds one pixel of every frame. */
+TARGET_SSE41 static void minmax_batch_sse41(const float *frames, size_t pixels, size_t count, float *min_values, size_t *min_indices, float *max_values, size_t *max_indices) {
+    size_t f = 0;
+
+    for (; f + 4 <= count; f += 4) {
+        const float *p0 = frames + f * pixels;
+        const float *p1 = p0 + pixels;
+        const float *p2 = p1 + pixels;
+        const float *p3 = p2 + pixels;
+        __m128 vmin = _mm_set1_ps(FLT_MAX);
+        __m128 vmax = _mm_set1_ps(-FLT_MAX);
+        __m128i imin = _mm_setzero_si128();
+        __m128i imax = _mm_setzero_si128();
+        size_t i = 0;
+
+        for (; i + 4 <= pixels; i += 4) {
+            __m128 r0 = _mm_loadu_ps(p0 + i);
+            __m128 r1 = _mm_loadu_ps(p1 + i);
+            __m128 r2 = _mm_loadu_ps(p2 + i);
+            __m128 r3 = _mm_loadu_ps(p3 + i);
+            _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+            lanes_update_sse41(r0, (uint32_t)i, &vmin, &imin, &vmax, &imax);
+            lanes_update_sse41(r1, (uint32_t)i + 1, &vmin, &imin, &vmax, &imax);
+            lanes_update_sse41(r2, (uint32_t)i + 2, &vmin, &imin, &vmax, &imax);
+            lanes_update_sse41(r3, (uint32_t)i + 3, &vmin, &imin, &vmax, &imax);
+        }
+        for (; i < pixels; i++) {
+            lanes_update_sse41(_mm_set_ps(p3[i], p2[i], p1[i], p0[i]), (uint32_t)i, &vmin, &imin, &vmax, &imax);
+        }
+
+        float lo[4], hi[4];
+        uint32_t lo_i[4], hi_i[4];
+        _mm_storeu_ps(lo, vmin);
+        _mm_storeu_ps(hi, vmax);
+        _mm_storeu_si128((__m128i *)lo_i, imin);
+        _mm_storeu_si128((__m128i *)hi_i, imax);
+        for (int l = 0; l < 4; l++) {
+            min_values[f + l] = lo[l];
+            min_indices[f + l] = lo_i[l];
+            max_values[f + l] = hi[l];
+            max_indices[f + l] = hi_i[l];
+        }
+    }
+
+    for (; f < count; f++) {
+        minmax_sse41(frames + f * pixels, pixels, &min_values[f], &min_indices[f], &max_values[f], &max_indices[f]);
+    }
+}
+
+const thermal_simd_ops_t thermal_simd_sse41_ops = {
+    .level = THERMAL_SIMD_SSE41,
+    .name = "sse4.1",
+    .minmax = minmax_sse41,
+    .colormap = colormap_sse41,
+    .bilinear_row = bilinear_row_sse41,
+    .median3_row = median3_row_sse41,
+    .ir_decode = ir_decode_sse41,
+    .threshold_bits = threshold_bits_sse41,
+    .minmax_batch = minmax_batch_sse41
+};
+
+/* ---- AVX2 ---- */
+
+TARGET_AVX2 static void minmax_avx2(const float *data, size_t count, float *min_value, size_t *min_index, float *max_value, size_t *max_index) {
+    __m256 vmin = _mm256_set1_ps(FLT_MAX);
+    __m256 vmax = _mm256_set1_ps(-FLT_MAX);
+    size_t i = 0;
+
+    for (; i + 8 <= count; i += 8) {
+        __m256 v = _mm256_loadu_ps(data + i);
+        vmin = _mm256_min_ps(v, vmin);
+        vmax = _mm256_max_ps(v, vmax);
+    }
+
+    float lanes_min[8], lanes_max[8];
+    _mm256_storeu_ps(lanes_min, vmin);
+    _mm256_storeu_ps(lanes_max, vmax);
+
+    float lo = FLT_MAX;
+    float hi = -FLT_MAX;
+    for (int l = 0; l < 8; l++) {
+        if (lanes_min[l] < lo) lo = lanes_min[l];
+        if (lanes_max[l] > hi) hi = lanes_max[l];
+    }
+    for (; i < count; i++) {
+        if (data[i] < lo) lo = data[i];
+        if (data[i] > hi) hi = data[i];
+    }
+
+    *min_index = 0;
+    *max_index = 0;
+    *min_value = find_first_sse41(data, count, lo, min_index) ? data[*min_index] : FLT_MAX;
+    *max_value = find_first_sse41(data, count, hi, max_index) ? data[*max_index] : -FLT_MAX;
+}
+
+TARGET_AVX2 static void bilinear_row_avx2(const float *row1, const float *row2, uint16_t src_width, float x_ratio, float dy, uint16_t x_start, uint16_t x_end, float *out) {
+    const __m256 one = _mm256_set1_ps(1.0f);
+    __m256 ratio = _mm256_set1_ps(x_ratio);
+    __m256 wy1 = _mm256_set1_ps(1.0f - dy);
+    __m256 wy2 = _mm256_set1_ps(dy);
+    __m256i last = _mm256_set1_epi32(src_width - 1);
+    uint32_t x = x_start;
+
+    for (; x + 8 <= x_end; x += 8) {
+        __m256i xs = _mm256_add_epi32(_mm256_set1_epi32((int)x), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+        __m256 src_x = _mm256_mul_ps(_mm256_cvtepi32_ps(xs), ratio);
+        __m256i x1 = _mm256_cvttps_epi32(src_x);
+        __m256i x2 = _mm256_min_epi32(_mm256_add_epi32(x1, _mm256_set1_epi32(1)), last);
+        __m256 dx = _mm256_sub_ps(src_x, _mm256_cvtepi32_ps(x1));
+        __m256 wx1 = _mm256_sub_ps(one, dx);
+
+        __m256 q11 = _mm256_i32gather_ps(row1, x1, 4);
+        __m256 q21 = _mm256_i32gather_ps(row1, x2, 4);
+        __m256 q12 = _mm256_i32gather_ps(row2, x1, 4);
+        __m256 q22 = _mm256_i32gather_ps(row2, x2, 4);
+
+        __m256 r1 = _mm256_add_ps(_mm256_mul_ps(q11, wx1), _mm256_mul_ps(q21, dx));
+        __m256 r2 = _mm256_add_ps(_mm256_mul_ps(q12, wx1), _mm256_mul_ps(q22, dx));
+        _mm256_storeu_ps(out + x, _mm256_add_ps(_mm256_mul_ps(r1, wy1), _mm256_mul_ps(r2, wy2)));
+    }
+
+    bilinear_row_sse41(row1, row2, src_width, x_ratio, dy, (uint16_t)x, x_end, out);
+}
+
+#define SORT2_AVX(a, b) do { __m256 lo_ = _mm256_min_ps((a), (b)); (b) = _mm256_max_ps((b), (a)); (a) = lo_; } while (0)
+
+TARGET_AVX2 static void median3_row_avx2(const float *up, const float *row, const float *down, uint16_t x_start, uint16_t x_end, float *out) {
+    uint32_t x = x_start;
+
+    for (; x + 8 <= x_end; x += 8) {
+        __m256 p0 = _mm256_loadu_ps(up + x - 1), p1 = _mm256_loadu_ps(up + x), p2 = _mm256_loadu_ps(up + x + 1);
+        __m256 p3 = _mm256_loadu_ps(row + x - 1), p4 = _mm256_loadu_ps(row + x), p5 = _mm256_loadu_ps(row + x + 1);
+        __m256 p6 = _mm256_loadu_ps(down + x - 1), p7 = _mm256_loadu_ps(down + x), p8 = _mm256_loadu_ps(down + x + 1);
+
+        SORT2_AVX(p1, p2); SORT2_AVX(p4, p5); SORT2_AVX(p7, p8);
+        SORT2_AVX(p0, p1); SORT2_AVX(p3, p4); SORT2_AVX(p6, p7);
+        SORT2_AVX(p1, p2); SORT2_AVX(p4, p5); SORT2_AVX(p7, p8);
+        SORT2_AVX(p0, p3); SORT2_AVX(p5, p8); SORT2_AVX(p4, p7);
+        SORT2_AVX(p3, p6); SORT2_AVX(p1, p4); SORT2_AVX(p2, p5);
+        SORT2_AVX(p4, p7); SORT2_AVX(p4, p2); SORT2_AVX(p6, p4);
+        SORT2_AVX(p4, p2);
+        _mm256_storeu_ps(out + x, p4);
+    }
+
+    median3_row_sse41(up, row, down, (uint16_t)x, x_end, out);
+}
+
+TARGET_AVX2 static void ir_decode_avx2(const uint16_t *raw, const uint16_t *alpha, const int16_t *offset, const float *kta, const float *kv, float ta, float vdd, size_t count, float *out) {
+    const __m256 one = _mm256_set1_ps(1.0f);
+    __m256 ta_delta = _mm256_set1_ps(ta - 25.0f);
+    __m256 vdd_delta = _mm256_set1_ps(vdd - 3.3f);
+    size_t i = 0;
+
+    for (; i + 8 <= count; i += 8) {
+        __m256 vir = _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)(raw + i))));
+        __m256 alpha_comp = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)(alpha + i)))), _mm256_set1_ps(1.0f / 65536.0f));
+        __m256 offset_comp = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)(offset + i))));
+
+        __m256 ta_term = _mm256_add_ps(one, _mm256_mul_ps(_mm256_loadu_ps(kta + i), ta_delta));
+        __m256 vdd_term = _mm256_add_ps(one, _mm256_mul_ps(_mm256_loadu_ps(kv + i), vdd_delta));
+        __m256 vir_comp = _mm256_sub_ps(vir, _mm256_mul_ps(_mm256_mul_ps(offset_comp, ta_term), vdd_term));
+
+        __m256 sx = _mm256_mul_ps(alpha_comp, vir_comp);
+        sx = _mm256_blendv_ps(sx, one, _mm256_cmp_ps(sx, _mm256_setzero_ps(), _CMP_LE_OQ));
+
+        __m256 temp_k = _mm256_sqrt_ps(_mm256_sqrt_ps(_mm256_div_ps(sx, _mm256_set1_ps(5.67e-8f))));
+        _mm256_storeu_ps(out + i, _mm256_sub_ps(temp_k, _mm256_set1_ps(273.15f)));
+    }
+
+    ir_decode_sse41(raw + i, alpha + i, offset + i, kta + i, kv + i, ta, vdd, count - i, out + i);
+}
+
+TARGET_AVX2 static void threshold_bits_avx2(const float *src, size_t count, float threshold, uint64_t *bits) {
+    __m256 t = _mm256_set1_ps(threshold);
+
+    for (size_t i = 0; i < count; i += 64) {
+        size_t n = count - i < 64 ? count - i : 64;
+        uint64_t word = 0;
+        size_t b = 0;
+        for (; b + 8 <= n; b += 8) {
+            word |= (uint64_t)_mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(src + i + b), t, _CMP_GE_OQ)) << b;
+        }
+        for (; b < n; b++) {
+            word |= (uint64_t)(src[i + b] >= threshold) << b;
+        }
+        bits[i / 64] = word;
+    }
+}
+
+TARGET_AVX2 static inline void lanes_update_avx2(__m256 v, uint32_t index, __m256 *vmin, __m256i *imin, __m256 *vmax, __m256i *imax) {
+    __m256i vi = _mm256_set1_epi32((int32_t)index);
+    __m256 lt = _mm256_cmp_ps(v, *vmin, _CMP_LT_OQ);
+    __m256 gt = _mm256_cmp_ps(v, *vmax, _CMP_GT_OQ);
+    *vmin = _mm256_blendv_ps(*vmin, v, lt);
+    *imin = _mm256_blendv_epi8(*imin, vi, _mm256_castps_si256(lt));
+    *vmax = _mm256_blendv_ps(*vmax, v, gt);
+    *imax = _mm256_blendv_epi8(*imax, vi, _mm256_castps_si256(gt));
+}
+
+/* Eight frames at a time as two transposed 4x4 halves; leftover frames go through the SSE4.1 path. */
+TARGET_AVX2 static void minmax_batch_avx2(const float *frames, size_t pixels, size_t count, float *min_values, size_t *min_indices, float *max_values, size_t *max_indices) {
+    size_t f = 0;
+
+    for (; f + 8 <= count; f += 8) {
+        const float *p[8];
+        for (int l = 0; l < 8; l++) {
+            p[l] = frames + (f + l) * pixels;
+        }
+        __m256 vmin = _mm256_set1_ps(FLT_MAX);
+        __m256 vmax = _mm256_set1_ps(-FLT_MAX);
+        __m256i imin = _mm256_setzero_si256();
+        __m256i imax = _mm256_setzero_si256();
+        size_t i = 0;
+
+        for (; i + 4 <= pixels; i += 4) {
+            __m128 a0 = _mm_loadu_ps(p[0] + i);
+            __m128 a1 = _mm_loadu_ps(p[1] + i);
+            __m128 a2 = _mm_loadu_ps(p[2] + i);
+            __m128 a3 = _mm_loadu_ps(p[3] + i);
+            __m128 b0 = _mm_loadu_ps(p[4] + i);
+            __m128 b1 = _mm_loadu_ps(p[5] + i);
+            __m128 b2 = _mm_loadu_ps(p[6] + i);
+            __m128 b3 = _mm_loadu_ps(p[7] + i);
+            _MM_TRANSPOSE4_PS(a0, a1, a2, a3);
+            _MM_TRANSPOSE4_PS(b0, b1, b2, b3);
+            lanes_update_avx2(_mm256_insertf128_ps(_mm256_castps128_ps256(a0), b0, 1), (uint32_t)i, &vmin, &imin, &vmax, &imax);
+            lanes_update_avx2(_mm256_insertf128_ps(_mm256_castps128_ps256(a1), b1, 1), (uint32_t)i + 1, &vmin, &imin, &vmax, &imax);
+            lanes_update_avx2(_mm256_insertf128_ps(_mm256_castps128_ps256(a2), b2, 1), (uint32_t)i + 2, &vmin, &imin, &vmax, &imax);
+            lanes_update_avx2(_mm256_insertf128_ps(_mm256_castps128_ps256(a3), b3, 1), (uint32_t)i + 3, &vmin, &imin, &vmax, &imax);
+        }
+        for (; i < pixels; i++) {
+            __m256 v = _mm256_set_ps(p[7][i], p[6][i], p[5][i], p[4][i], p[3][i], p[2][i], p[1][i], p[0][i]);
+            lanes_update_avx2(v, (uint32_t)i, &vmin, &imin, &vmax, &imax);
+        }
+
+        float lo[8], hi[8];
+        uint32_t lo_i[8], hi_i[8];
+        _mm256_storeu_ps(lo, vmin);
+        _mm256_storeu_ps(hi, vmax);
+        _mm256_storeu_si256((__m256i *)lo_i, imin);
+        _mm256_storeu_si256((__m256i *)hi_i, imax);
+        for (int l = 0; l < 8; l++) {
+            min_values[f + l] = lo[l];
+            min_indices[f + l] = lo_i[l];
+            max_values[f + l] = hi[l];
+            max_indices[f + l] = hi_i[l];
+        }
+    }
+
+    minmax_batch_sse41(frames + f * pixels, pixels, count - f, min_values + f, min_indices + f, max_values + f, max_indices + f);
+}
+
+const thermal_simd_ops_t thermal_simd_avx2_ops = {
+    .level = THERMAL_SIMD_AVX2,
+    .name = "avx2",
+    .minmax = minmax_avx2,
+    .colormap = colormap_sse41,
+    .bilinear_row = bilinear_row_avx2,
+    .median3_row = median3_row_avx2,
+    .ir_decode = ir_decode_avx2,
+    .threshold_bits = threshold_bits_avx2,
+    .minmax_batch = minmax_batch_avx2
+};
+
+#endif
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
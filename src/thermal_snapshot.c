@@ -0,0 +1,176 @@
+#include "thermal_snapshot.h"
+#include <string.h>
+
+/* Sequence values never written as a stable state, so an untouched buffer never matches 2 * id. */
+#define SNAPSHOT_SEQUENCE_EMPTY 1u
+
+thermal_status_t thermal_snapshot_init(thermal_snapshot_t *snapshot, const thermal_resolution_t *resolution, float *storage, size_t storage_len) {
+    if (!snapshot || !resolution || !storage || resolution->width == 0 || resolution->height == 0) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    size_t pixels = (size_t)resolution->width * resolution->height;
+    if (storage_len < pixels * THERMAL_SNAPSHOT_BUFFERS) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    memset(snapshot, 0, sizeof(*snapshot));
+    for (int i = 0; i < THERMAL_SNAPSHOT_BUFFERS; i++) {
+        snapshot->frames[i].data = storage + pixels * i;
+        snapshot->frames[i].resolution = *resolution;
+        atomic_init(&snapshot->sequence[i], SNAPSHOT_SEQUENCE_EMPTY);
+    }
+
+    atomic_init(&snapshot->latest, 0);
+    atomic_init(&snapshot->retries, 0);
+    snapshot->next_id = 1;
+    return THERMAL_OK;
+}
+
+/* Writer side: hands out the back buffer, which holds the frame before the latest one. */
+thermal_frame_t *thermal_snapshot_write_begin(thermal_snapshot_t *snapshot) {
+    if (!snapshot) {
+        return NULL;
+    }
+
+    uint8_t back = snapshot->back;
+    atomic_store_explicit(&snapshot->sequence[back], snapshot->next_id * 2u - 1u, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    return &snapshot->frames[back];
+}
+
+thermal_status_t thermal_snapshot_write_end(thermal_snapshot_t *snapshot) {
+    if (!snapshot) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    uint32_t id = snapshot->next_id;
+    platform_atomic_store(&snapshot->sequence[snapshot->back], id * 2u);
+    platform_atomic_store(&snapshot->latest, id);
+
+    snapshot->back ^= 1;
+    /* Id 0 means "nothing published", so it is skipped when the counter wraps. */
+    snapshot->next_id = id + 1 ? id + 1 : 1;
+    return THERMAL_OK;
+}
+
+thermal_status_t thermal_snapshot_publish(thermal_snapshot_t *snapshot, const thermal_frame_t *frame) {
+    if (!snapshot || !frame || !frame->data) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    const thermal_resolution_t *resolution = &snapshot->frames[0].resolution;
+    if (frame->resolution.width != resolution->width || frame->resolution.height != resolution->height) {
+        return THERMAL_ERR_FRAME_INVALID;
+    }
+
+    thermal_frame_t *back = thermal_snapshot_write_begin(snapshot);
+    memcpy(back->data, frame->data, (size_t)resolution->width * resolution->height * sizeof(float));
+    back->timestamp = frame->timestamp;
+    back->unchanged = frame->unchanged;
+    return thermal_snapshot_write_end(snapshot);
+}
+
+thermal_status_t thermal_snapshot_view_begin(thermal_snapshot_t *snapshot, thermal_snapshot_view_t *view) {
+    if (!snapshot || !view) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    for (int attempt = 0; attempt < THERMAL_SNAPSHOT_RETRIES; attempt++) {
+        uint32_t id = platform_atomic_load(&snapshot->latest);
+        if (id == 0) {
+            return THERMAL_ERR_NOT_INIT;
+        }
+
+        for (uint8_t i = 0; i < THERMAL_SNAPSHOT_BUFFERS; i++) {
+            uint32_t sequence = platform_atomic_load(&snapshot->sequence[i]);
+            if (sequence == id * 2u) {
+                view->frame = snapshot->frames[i];
+                view->id = id;
+                view->sequence = sequence;
+                view->buffer = i;
+                return THERMAL_OK;
+            }
+        }
+
+        /* The writer lapped this reader between the two loads; look again. */
+        platform_atomic_fetch_add(&snapshot->retries, 1);
+    }
+
+    return THERMAL_ERR_TIMEOUT;
+}
+
+thermal_status_t thermal_snapshot_view_end(thermal_snapshot_t *snapshot, const thermal_snapshot_view_t *view, thermal_snapshot_reader_t *reader) {
+    if (!snapshot || !view || view->buffer >= THERMAL_SNAPSHOT_BUFFERS) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    atomic_thread_fence(memory_order_acquire);
+    if (atomic_load_explicit(&snapshot->sequence[view->buffer], memory_order_relaxed) != view->sequence) {
+        platform_atomic_fetch_add(&snapshot->retries, 1);
+        return THERMAL_ERR_FRAME_INVALID;
+    }
+
+    if (!reader) {
+        return THERMAL_OK;
+    }
+
+    reader->first_missed = 0;
+    reader->missed = 0;
+    if (reader->last_id != 0 && view->id != reader->last_id) {
+        uint32_t missed = view->id - reader->last_id - 1;
+        if (view->id < reader->last_id) {
+            missed--;
+        }
+        if (missed > 0) {
+            reader->first_missed = reader->last_id + 1 ? reader->last_id + 1 : 1;
+            reader->missed = missed;
+            reader->total_missed += missed;
+        }
+    }
+
+    reader->last_id = view->id;
+    return THERMAL_OK;
+}
+
+thermal_status_t thermal_snapshot_read(thermal_snapshot_t *snapshot, thermal_frame_t *dst, thermal_snapshot_reader_t *reader) {
+    if (!snapshot || !dst || !dst->data) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    thermal_status_t status = THERMAL_ERR_TIMEOUT;
+    for (int attempt = 0; attempt < THERMAL_SNAPSHOT_RETRIES; attempt++) {
+        thermal_snapshot_view_t view;
+        status = thermal_snapshot_view_begin(snapshot, &view);
+        if (status != THERMAL_OK) {
+            return status;
+        }
+
+        memcpy(dst->data, view.frame.data, (size_t)view.frame.resolution.width * view.frame.resolution.height * sizeof(float));
+        dst->resolution = view.frame.resolution;
+        dst->timestamp = view.frame.timestamp;
+        dst->unchanged = view.frame.unchanged;
+
+        status = thermal_snapshot_view_end(snapshot, &view, reader);
+        if (status != THERMAL_ERR_FRAME_INVALID) {
+            return status;
+        }
+    }
+
+    return THERMAL_ERR_TIMEOUT;
+}
+
+uint32_t thermal_snapshot_latest_id(thermal_snapshot_t *snapshot) {
+    return snapshot ? platform_atomic_load(&snapshot->latest) : 0;
+}
+
+void thermal_snapshot_reader_init(thermal_snapshot_reader_t *reader) {
+    if (reader) {
+        memset(reader, 0, sizeof(*reader));
+    }
+}
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
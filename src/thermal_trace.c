@@ -0,0 +1,180 @@
+#include "thermal_trace.h"
+#include "platform/platform_hal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TRACE_RING_MASK (THERMAL_TRACE_RING_SIZE - 1)
+#define TRACE_CHUNK_MAX 160
+
+typedef struct {
+    platform_atomic_u32_t sequence;
+    thermal_trace_event_t event;
+} trace_slot_t;
+
+static const char *const stage_names[THERMAL_STAGE_COUNT] = {
+    "frame", "bus", "decode", "filter", "interpolate", "colormap", "app"
+};
+
+static trace_slot_t trace_ring[THERMAL_TRACE_RING_SIZE];
+static platform_atomic_u32_t trace_write_pos;
+static platform_atomic_u32_t trace_overruns[THERMAL_STAGE_COUNT];
+static uint32_t trace_deadline_us[THERMAL_STAGE_COUNT];
+static _Thread_local uint32_t trace_frame_id;
+
+uint64_t thermal_trace_now(void) {
+    return platform_time_us();
+}
+
+void thermal_trace_set_frame(uint32_t frame_id) {
+    trace_frame_id = frame_id;
+}
+
+uint32_t thermal_trace_current_frame(void) {
+    return trace_frame_id;
+}
+
+/* Writers claim slots with fetch_add and overwrite the oldest; sequence marks a slot complete. */
+void thermal_trace_record(uint8_t stage, uint32_t frame_id, uint64_t begin_us) {
+    if (stage >= THERMAL_STAGE_COUNT) {
+        return;
+    }
+
+    uint64_t end_us = platform_time_us();
+    uint32_t duration = (uint32_t)(end_us - begin_us);
+    uint32_t pos = platform_atomic_fetch_add(&trace_write_pos, 1);
+    trace_slot_t *slot = &trace_ring[pos & TRACE_RING_MASK];
+
+    /* The fence keeps the event stores below the invalidating store; readers pair it with an acquire fence. */
+    atomic_store_explicit(&slot->sequence, 0, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    slot->event.begin_us = begin_us;
+    slot->event.duration_us = duration;
+    slot->event.frame_id = frame_id;
+    slot->event.stage = stage;
+    platform_atomic_store(&slot->sequence, pos + 1);
+
+    if (trace_deadline_us[stage] && duration > trace_deadline_us[stage]) {
+        platform_atomic_fetch_add(&trace_overruns[stage], 1);
+    }
+}
+
+void thermal_trace_reset(void) {
+    for (uint32_t i = 0; i < THERMAL_TRACE_RING_SIZE; i++) {
+        platform_atomic_store(&trace_ring[i].sequence, 0);
+    }
+    for (int i = 0; i < THERMAL_STAGE_COUNT; i++) {
+        platform_atomic_store(&trace_overruns[i], 0);
+    }
+    platform_atomic_store(&trace_write_pos, 0);
+}
+
+thermal_status_t thermal_trace_set_deadline(thermal_trace_stage_t stage, uint32_t deadline_us) {
+    if (stage >= THERMAL_STAGE_COUNT) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    trace_deadline_us[stage] = deadline_us;
+    return THERMAL_OK;
+}
+
+static int read_slot(uint32_t pos, thermal_trace_event_t *event) {
+    trace_slot_t *slot = &trace_ring[pos & TRACE_RING_MASK];
+    if (platform_atomic_load(&slot->sequence) != pos + 1) {
+        return 0;
+    }
+
+    *event = slot->event;
+    atomic_thread_fence(memory_order_acquire);
+    return atomic_load_explicit(&slot->sequence, memory_order_relaxed) == pos + 1;
+}
+
+static uint32_t window_start(uint32_t end) {
+    return (end > THERMAL_TRACE_RING_SIZE) ? end - THERMAL_TRACE_RING_SIZE : 0;
+}
+
+static int compare_u32(const void *a, const void *b) {
+    uint32_t ua = *(const uint32_t *)a;
+    uint32_t ub = *(const uint32_t *)b;
+    return (ua > ub) - (ua < ub);
+}
+
+/* Durations are sorted in the caller's arena, so concurrent summaries with separate arenas do not interfere. */
+thermal_status_t thermal_trace_summary(thermal_trace_stage_t stage, thermal_trace_summary_t *summary, thermal_arena_t *scratch) {
+    if (stage >= THERMAL_STAGE_COUNT || !summary) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    size_t mark = thermal_arena_mark(scratch);
+    uint32_t *durations = thermal_arena_alloc(scratch, THERMAL_TRACE_RING_SIZE * sizeof(uint32_t));
+    if (!durations) {
+        thermal_arena_release(scratch, mark);
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    memset(summary, 0, sizeof(*summary));
+    summary->overruns = platform_atomic_load(&trace_overruns[stage]);
+
+    uint32_t end = platform_atomic_load(&trace_write_pos);
+    uint32_t count = 0;
+    thermal_trace_event_t event;
+
+    for (uint32_t pos = window_start(end); pos != end; pos++) {
+        if (read_slot(pos, &event) && event.stage == stage) {
+            durations[count++] = event.duration_us;
+        }
+    }
+
+    if (count > 0) {
+        qsort(durations, count, sizeof(uint32_t), compare_u32);
+        summary->count = count;
+        summary->p50_us = durations[(count - 1) * 50 / 100];
+        summary->p99_us = durations[(count - 1) * 99 / 100];
+        summary->max_us = durations[count - 1];
+    }
+
+    thermal_arena_release(scratch, mark);
+    return THERMAL_OK;
+}
+
+static void write_str(thermal_trace_write_fn write, void *ctx, const char *str) {
+    write(str, strlen(str), ctx);
+}
+
+thermal_status_t thermal_trace_export_chrome(thermal_trace_write_fn write, void *ctx) {
+    if (!write) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    char chunk[TRACE_CHUNK_MAX];
+    uint32_t end = platform_atomic_load(&trace_write_pos);
+    thermal_trace_event_t event;
+    int first = 1;
+
+    write_str(write, ctx, "{\"traceEvents\":[");
+
+    for (uint32_t pos = window_start(end); pos != end; pos++) {
+        if (!read_slot(pos, &event)) {
+            continue;
+        }
+
+        int len = snprintf(chunk, sizeof(chunk),
+                           "%s{\"name\":\"%s\",\"cat\":\"thermal\",\"ph\":\"X\",\"ts\":%llu,\"dur\":%u,"
+                           "\"pid\":1,\"tid\":%u,\"args\":{\"frame\":%u}}",
+                           first ? "" : ",", stage_names[event.stage],
+                           (unsigned long long)event.begin_us, event.duration_us,
+                           (unsigned)event.stage, event.frame_id);
+        if (len > 0) {
+            write(chunk, (size_t)len < sizeof(chunk) ? (size_t)len : sizeof(chunk) - 1, ctx);
+        }
+        first = 0;
+    }
+
+    write_str(write, ctx, "],\"displayTimeUnit\":\"ms\"}\n");
+    return THERMAL_OK;
+}
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
@@ -0,0 +1,382 @@
+#include "thermal_tracker.h"
+#include <string.h>
+
+#define NO_MATCH 0xFF
+
+thermal_status_t thermal_tracker_init(thermal_tracker_t *tracker, const thermal_tracker_config_t *config) {
+    if (!tracker || !config) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    if (!(config->gate_distance > 0.0f) || !(config->alpha > 0.0f && config->alpha <= 1.0f) ||
+        !(config->beta >= 0.0f && config->beta <= 1.0f) || config->confirm_hits == 0) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    memset(tracker, 0, sizeof(*tracker));
+    tracker->config = *config;
+    tracker->next_id = 1;
+
+    return THERMAL_OK;
+}
+
+void thermal_tracker_reset(thermal_tracker_t *tracker) {
+    if (!tracker) {
+        return;
+    }
+
+    tracker->track_count = 0;
+    for (uint8_t i = 0; i < tracker->line_count; i++) {
+        tracker->lines[i].positive = 0;
+        tracker->lines[i].negative = 0;
+    }
+}
+
+thermal_status_t thermal_tracker_add_line(thermal_tracker_t *tracker, float x0, float y0, float x1, float y1, uint8_t *line_index) {
+    if (!tracker || (x0 == x1 && y0 == y1)) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    if (tracker->line_count >= THERMAL_TRACKER_MAX_LINES) {
+        return THERMAL_ERR_UNSUPPORTED;
+    }
+
+    thermal_tracker_line_t *line = &tracker->lines[tracker->line_count];
+    memset(line, 0, sizeof(*line));
+    line->x0 = x0;
+    line->y0 = y0;
+    line->x1 = x1;
+    line->y1 = y1;
+
+    if (line_index) {
+        *line_index = tracker->line_count;
+    }
+    tracker->line_count++;
+
+    return THERMAL_OK;
+}
+
+uint8_t thermal_tracker_occupancy(const thermal_tracker_t *tracker) {
+    if (!tracker) {
+        return 0;
+    }
+
+    uint8_t occupancy = 0;
+    for (uint8_t i = 0; i < tracker->track_count; i++) {
+        occupancy += tracker->tracks[i].confirmed;
+    }
+    return occupancy;
+}
+
+static void emit_event(thermal_tracker_t *tracker, thermal_track_event_t *events, size_t max_events, size_t *event_count,
+                       thermal_track_event_type_t type, const thermal_track_t *track, uint8_t line, int8_t direction) {
+    if (*event_count >= max_events) {
+        tracker->dropped_events++;
+        return;
+    }
+
+    thermal_track_event_t *event = &events[(*event_count)++];
+    event->type = type;
+    event->track_id = track->id;
+    event->line = line;
+    event->direction = direction;
+    event->x = track->x;
+    event->y = track->y;
+}
+
+static float side_of(const thermal_tracker_line_t *line, float x, float y) {
+    return (line->x1 - line->x0) * (y - line->y0) - (line->y1 - line->y0) * (x - line->x0);
+}
+
+/* A point on the line counts as the non-negative side. A move is a crossing only if it changes side between the line's end points. */
+static int8_t crossing_direction(const thermal_tracker_line_t *line, float ax, float ay, float bx, float by) {
+    float side_a = side_of(line, ax, ay);
+    float side_b = side_of(line, bx, by);
+
+    if ((side_a < 0.0f) == (side_b < 0.0f)) {
+        return 0;
+    }
+
+    float ex = bx - ax;
+    float ey = by - ay;
+    float end_0 = ex * (line->y0 - ay) - ey * (line->x0 - ax);
+    float end_1 = ex * (line->y1 - ay) - ey * (line->x1 - ax);
+    if ((end_0 < 0.0f) == (end_1 < 0.0f) && end_0 != 0.0f && end_1 != 0.0f) {
+        return 0;
+    }
+
+    /* side_b may be exactly 0 (integer hotspots on an integer line), which is the non-negative side. */
+    return side_a < 0.0f ? 1 : -1;
+}
+
+static uint16_t allocate_id(thermal_tracker_t *tracker) {
+    uint16_t id = tracker->next_id++;
+    if (tracker->next_id == 0) {
+        tracker->next_id = 1;
+    }
+    return id;
+}
+
+#define PAIR_COUNT (THERMAL_TRACKER_MAX_TRACKS * THERMAL_TRACKER_MAX_DETECTIONS)
+_Static_assert(PAIR_COUNT <= 256, "pair indices must fit in uint8_t");
+
+static float pair_cost(const thermal_tracker_t *tracker, uint8_t pair) {
+    return tracker->cost[pair / THERMAL_TRACKER_MAX_DETECTIONS][pair % THERMAL_TRACKER_MAX_DETECTIONS];
+}
+
+/* Cheaper pairs first, ties to the lowest track then detection index. */
+static int pair_before(const thermal_tracker_t *tracker, uint8_t a, uint8_t b) {
+    float cost_a = pair_cost(tracker, a);
+    float cost_b = pair_cost(tracker, b);
+    return cost_a < cost_b || (cost_a == cost_b && a < b);
+}
+
+static void sift_down(const thermal_tracker_t *tracker, uint8_t *heap, size_t count, size_t root) {
+    for (;;) {
+        size_t child = root * 2 + 1;
+        if (child >= count) {
+            return;
+        }
+        if (child + 1 < count && pair_before(tracker, heap[child], heap[child + 1])) {
+            child++;
+        }
+        if (!pair_before(tracker, heap[root], heap[child])) {
+            return;
+        }
+
+        uint8_t swap = heap[root];
+        heap[root] = heap[child];
+        heap[child] = swap;
+        root = child;
+    }
+}
+
+static void sort_pairs(const thermal_tracker_t *tracker, uint8_t *pairs, size_t count) {
+    for (size_t i = count / 2; i-- > 0;) {
+        sift_down(tracker, pairs, count, i);
+    }
+    for (size_t end = count; end-- > 1;) {
+        uint8_t swap = pairs[0];
+        pairs[0] = pairs[end];
+        pairs[end] = swap;
+        sift_down(tracker, pairs, end, 0);
+    }
+}
+
+/*
+ * Associates in one O(tracks * detections) mutual-nearest pass on the gated cost matrix, which assigns every
+ * well-separated object. Pairs left in conflict are then matched closest first from a heap-sorted list of the
+ * remaining gated pairs, so the worst case is O(T * D * log(T * D)) rather than one pass per assignment.
+ */
+static void associate(thermal_tracker_t *tracker, size_t count, uint8_t *track_match, uint8_t *detection_match) {
+    uint8_t track_count = tracker->track_count;
+    float gate = tracker->config.gate_distance * tracker->config.gate_distance;
+    uint8_t best_detection[THERMAL_TRACKER_MAX_TRACKS];
+    uint8_t best_track[THERMAL_TRACKER_MAX_DETECTIONS];
+    float best_detection_cost[THERMAL_TRACKER_MAX_DETECTIONS];
+
+    for (size_t d = 0; d < count; d++) {
+        detection_match[d] = NO_MATCH;
+        best_track[d] = NO_MATCH;
+    }
+
+    for (uint8_t t = 0; t < track_count; t++) {
+        track_match[t] = NO_MATCH;
+        best_detection[t] = NO_MATCH;
+
+        float best_cost = 0.0f;
+        for (size_t d = 0; d < count; d++) {
+            float cost = tracker->cost[t][d];
+            if (cost > gate) {
+                continue;
+            }
+            if (best_detection[t] == NO_MATCH || cost < best_cost) {
+                best_cost = cost;
+                best_detection[t] = (uint8_t)d;
+            }
+            if (best_track[d] == NO_MATCH || cost < best_detection_cost[d]) {
+                best_detection_cost[d] = cost;
+                best_track[d] = t;
+            }
+        }
+    }
+
+    uint8_t unmatched = 0;
+    for (uint8_t t = 0; t < track_count; t++) {
+        uint8_t d = best_detection[t];
+        if (d != NO_MATCH && best_track[d] == t) {
+            track_match[t] = d;
+            detection_match[d] = t;
+        } else if (d != NO_MATCH) {
+            unmatched = 1;
+        }
+    }
+
+    if (!unmatched) {
+        return;
+    }
+
+    uint8_t pairs[PAIR_COUNT];
+    size_t pair_count = 0;
+    for (uint8_t t = 0; t < track_count; t++) {
+        if (track_match[t] != NO_MATCH) {
+            continue;
+        }
+        for (size_t d = 0; d < count; d++) {
+            if (detection_match[d] == NO_MATCH && tracker->cost[t][d] <= gate) {
+                pairs[pair_count++] = (uint8_t)(t * THERMAL_TRACKER_MAX_DETECTIONS + d);
+            }
+        }
+    }
+
+    sort_pairs(tracker, pairs, pair_count);
+
+    for (size_t i = 0; i < pair_count; i++) {
+        uint8_t t = (uint8_t)(pairs[i] / THERMAL_TRACKER_MAX_DETECTIONS);
+        uint8_t d = (uint8_t)(pairs[i] % THERMAL_TRACKER_MAX_DETECTIONS);
+        if (track_match[t] == NO_MATCH && detection_match[d] == NO_MATCH) {
+            track_match[t] = d;
+            detection_match[d] = t;
+        }
+    }
+}
+
+thermal_status_t thermal_tracker_update(thermal_tracker_t *tracker, const thermal_detection_t *detections, size_t count, thermal_track_event_t *events, size_t max_events, size_t *event_count) {
+    if (!tracker || (count && !detections) || (max_events && !events) || !event_count) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    *event_count = 0;
+
+    if (count > THERMAL_TRACKER_MAX_DETECTIONS) {
+        tracker->dropped_detections += (uint32_t)(count - THERMAL_TRACKER_MAX_DETECTIONS);
+        count = THERMAL_TRACKER_MAX_DETECTIONS;
+    }
+
+    for (uint8_t t = 0; t < tracker->track_count; t++) {
+        thermal_track_t *track = &tracker->tracks[t];
+        track->x += track->vx;
+        track->y += track->vy;
+
+        for (size_t d = 0; d < count; d++) {
+            float dx = detections[d].x - track->x;
+            float dy = detections[d].y - track->y;
+            tracker->cost[t][d] = dx * dx + dy * dy;
+        }
+    }
+
+    uint8_t track_match[THERMAL_TRACKER_MAX_TRACKS];
+    uint8_t detection_match[THERMAL_TRACKER_MAX_DETECTIONS];
+    associate(tracker, count, track_match, detection_match);
+
+    float alpha = tracker->config.alpha;
+    float beta = tracker->config.beta;
+    uint8_t kept = 0;
+
+    for (uint8_t t = 0; t < tracker->track_count; t++) {
+        thermal_track_t track = tracker->tracks[t];
+
+        if (track_match[t] == NO_MATCH) {
+            if (++track.misses > tracker->config.max_misses) {
+                if (track.confirmed) {
+                    emit_event(tracker, events, max_events, event_count, THERMAL_TRACK_EVENT_END, &track, 0, 0);
+                }
+                continue;
+            }
+        } else {
+            const thermal_detection_t *detection = &detections[track_match[t]];
+            float rx = detection->x - track.x;
+            float ry = detection->y - track.y;
+            track.x += alpha * rx;
+            track.y += alpha * ry;
+            track.vx += beta * rx;
+            track.vy += beta * ry;
+            track.temperature = detection->temperature;
+            track.misses = 0;
+            if (track.hits < UINT16_MAX) {
+                track.hits++;
+            }
+
+            if (!track.confirmed && track.hits >= tracker->config.confirm_hits) {
+                track.confirmed = 1;
+                emit_event(tracker, events, max_events, event_count, THERMAL_TRACK_EVENT_START, &track, 0, 0);
+            } else if (track.confirmed) {
+                /* Only measured moves are checked, so a coasting prediction cannot trigger a crossing. */
+                for (uint8_t l = 0; l < tracker->line_count; l++) {
+                    thermal_tracker_line_t *line = &tracker->lines[l];
+                    int8_t direction = crossing_direction(line, track.last_x, track.last_y, track.x, track.y);
+                    if (direction == 0) {
+                        continue;
+                    }
+
+                    if (direction > 0) {
+                        line->positive++;
+                    } else {
+                        line->negative++;
+                    }
+                    emit_event(tracker, events, max_events, event_count, THERMAL_TRACK_EVENT_CROSS, &track, l, direction);
+                }
+            }
+
+            track.last_x = track.x;
+            track.last_y = track.y;
+        }
+
+        tracker->tracks[kept++] = track;
+    }
+    tracker->track_count = kept;
+
+    for (size_t d = 0; d < count; d++) {
+        if (detection_match[d] != NO_MATCH) {
+            continue;
+        }
+
+        if (tracker->track_count >= THERMAL_TRACKER_MAX_TRACKS) {
+            tracker->dropped_detections++;
+            continue;
+        }
+
+        thermal_track_t *track = &tracker->tracks[tracker->track_count++];
+        memset(track, 0, sizeof(*track));
+        track->id = allocate_id(tracker);
+        track->x = detections[d].x;
+        track->y = detections[d].y;
+        track->last_x = track->x;
+        track->last_y = track->y;
+        track->temperature = detections[d].temperature;
+        track->hits = 1;
+
+        if (tracker->config.confirm_hits <= 1) {
+            track->confirmed = 1;
+            emit_event(tracker, events, max_events, event_count, THERMAL_TRACK_EVENT_START, track, 0, 0);
+        }
+    }
+
+    return THERMAL_OK;
+}
+
+thermal_status_t thermal_tracker_update_hotspots(thermal_tracker_t *tracker, const thermal_hotspot_t *hotspots, size_t count, thermal_track_event_t *events, size_t max_events, size_t *event_count) {
+    if (count && !hotspots) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    thermal_detection_t detections[THERMAL_TRACKER_MAX_DETECTIONS] = {{0}};
+    size_t used = count < THERMAL_TRACKER_MAX_DETECTIONS ? count : THERMAL_TRACKER_MAX_DETECTIONS;
+
+    for (size_t i = 0; i < used; i++) {
+        detections[i].x = hotspots[i].x;
+        detections[i].y = hotspots[i].y;
+        detections[i].temperature = hotspots[i].temperature;
+    }
+
+    thermal_status_t status = thermal_tracker_update(tracker, detections, used, events, max_events, event_count);
+    if (status == THERMAL_OK && count > used) {
+        tracker->dropped_detections += (uint32_t)(count - used);
+    }
+    return status;
+}
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file
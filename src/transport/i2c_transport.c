@@ -1,6 +1,6 @@
 #include "thermal_transport.h"
-#include "esp32_hal.h"
-#include <stdio.h>
+#include "thermal_log.h"
+#include "platform/platform_hal.h"
 #include <string.h>
 
 #define I2C_MAX_RETRIES 3
@@ -10,7 +10,7 @@ static thermal_status_t i2c_init(void *hw_handle) {
     if (!hw_handle) {
         return THERMAL_ERR_INVALID_ARG;
     }
-    printf("I2C transport initialized\n");
+    THERMAL_LOG_DEBUG("I2C transport initialized\n");
     return THERMAL_OK;
 }
 
@@ -18,7 +18,7 @@ static thermal_status_t i2c_deinit(void *hw_handle) {
     if (!hw_handle) {
         return THERMAL_ERR_INVALID_ARG;
     }
-    printf("I2C transport deinitialized\n");
+    THERMAL_LOG_DEBUG("I2C transport deinitialized\n");
     return THERMAL_OK;
 }
 
@@ -28,14 +28,14 @@ static thermal_status_t i2c_read_reg(void *hw_handle, uint8_t dev_addr, uint16_t
     }
     
     for (int retry = 0; retry < I2C_MAX_RETRIES; retry++) {
-        int result = esp32_i2c_read(hw_handle, dev_addr, reg, data, len);
+        int result = platform_i2c_read(hw_handle, dev_addr, reg, data, len);
         if (result == 0) {
             return THERMAL_OK;
         }
-        printf("I2C read retry %d\n", retry + 1);
+        THERMAL_LOG_WARN("I2C read retry %d\n", retry + 1);
     }
     
-    printf("I2C read failed after %d retries\n", I2C_MAX_RETRIES);
+    THERMAL_LOG_ERROR("I2C read failed after %d retries\n", I2C_MAX_RETRIES);
     return THERMAL_ERR_IO;
 }
 
@@ -45,14 +45,14 @@ static thermal_status_t i2c_write_reg(void *hw_handle, uint8_t dev_addr, uint16_
     }
     
     for (int retry = 0; retry < I2C_MAX_RETRIES; retry++) {
-        int result = esp32_i2c_write(hw_handle, dev_addr, reg, data, len);
+        int result = platform_i2c_write(hw_handle, dev_addr, reg, data, len);
         if (result == 0) {
             return THERMAL_OK;
         }
-        printf("I2C write retry %d\n", retry + 1);
+        THERMAL_LOG_WARN("I2C write retry %d\n", retry + 1);
     }
     
-    printf("I2C write failed after %d retries\n", I2C_MAX_RETRIES);
+    THERMAL_LOG_ERROR("I2C write failed after %d retries\n", I2C_MAX_RETRIES);
     return THERMAL_ERR_IO;
 }
 
@@ -62,14 +62,14 @@ static thermal_status_t i2c_read_burst(void *hw_handle, uint8_t dev_addr, uint16
     }
     
     for (int retry = 0; retry < I2C_MAX_RETRIES; retry++) {
-        int result = esp32_i2c_read_burst(hw_handle, dev_addr, start_reg, buffer, len);
+        int result = platform_i2c_read_burst(hw_handle, dev_addr, start_reg, buffer, len);
         if (result == 0) {
             return THERMAL_OK;
         }
-        printf("I2C burst read retry %d\n", retry + 1);
+        THERMAL_LOG_WARN("I2C burst read retry %d\n", retry + 1);
     }
     
-    printf("I2C burst read failed after %d retries\n", I2C_MAX_RETRIES);
+    THERMAL_LOG_ERROR("I2C burst read failed after %d retries\n", I2C_MAX_RETRIES);
     return THERMAL_ERR_IO;
 }
 
@@ -80,6 +80,7 @@ thermal_status_t i2c_transport_create(thermal_transport_t *transport, void *hw_h
     
     transport->type = THERMAL_TRANSPORT_I2C;
     transport->hw_handle = hw_handle;
+    transport->bus = hw_handle;
     transport->init = i2c_init;
     transport->deinit = i2c_deinit;
     transport->read_reg = i2c_read_reg;
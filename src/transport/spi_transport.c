@@ -1,6 +1,6 @@
 #include "thermal_transport.h"
-#include "esp32_hal.h"
-#include <stdio.h>
+#include "thermal_log.h"
+#include "platform/platform_hal.h"
 #include <string.h>
 
 #define SPI_MAX_RETRIES 3
@@ -10,7 +10,7 @@ static thermal_status_t spi_init(void *hw_handle) {
     if (!hw_handle) {
         return THERMAL_ERR_INVALID_ARG;
     }
-    printf("SPI transport initialized\n");
+    THERMAL_LOG_DEBUG("SPI transport initialized\n");
     return THERMAL_OK;
 }
 
@@ -18,7 +18,7 @@ static thermal_status_t spi_deinit(void *hw_handle) {
     if (!hw_handle) {
         return THERMAL_ERR_INVALID_ARG;
     }
-    printf("SPI transport deinitialized\n");
+    THERMAL_LOG_DEBUG("SPI transport deinitialized\n");
     return THERMAL_OK;
 }
 
@@ -28,14 +28,14 @@ static thermal_status_t spi_read_reg(void *hw_handle, uint8_t dev_addr, uint16_t
     }
     
     for (int retry = 0; retry < SPI_MAX_RETRIES; retry++) {
-        int result = esp32_spi_read(hw_handle, dev_addr, reg, data, len);
+        int result = platform_spi_read(hw_handle, dev_addr, reg, data, len);
         if (result == 0) {
             return THERMAL_OK;
         }
-        printf("SPI read retry %d\n", retry + 1);
+        THERMAL_LOG_WARN("SPI read retry %d\n", retry + 1);
     }
     
-    printf("SPI read failed after %d retries\n", SPI_MAX_RETRIES);
+    THERMAL_LOG_ERROR("SPI read failed after %d retries\n", SPI_MAX_RETRIES);
     return THERMAL_ERR_IO;
 }
 
@@ -45,14 +45,14 @@ static thermal_status_t spi_write_reg(void *hw_handle, uint8_t dev_addr, uint16_
     }
     
     for (int retry = 0; retry < SPI_MAX_RETRIES; retry++) {
-        int result = esp32_spi_write(hw_handle, dev_addr, reg, data, len);
+        int result = platform_spi_write(hw_handle, dev_addr, reg, data, len);
         if (result == 0) {
             return THERMAL_OK;
         }
-        printf("SPI write retry %d\n", retry + 1);
+        THERMAL_LOG_WARN("SPI write retry %d\n", retry + 1);
     }
     
-    printf("SPI write failed after %d retries\n", SPI_MAX_RETRIES);
+    THERMAL_LOG_ERROR("SPI write failed after %d retries\n", SPI_MAX_RETRIES);
     return THERMAL_ERR_IO;
 }
 
@@ -62,14 +62,14 @@ static thermal_status_t spi_read_burst(void *hw_handle, uint8_t dev_addr, uint16
     }
     
     for (int retry = 0; retry < SPI_MAX_RETRIES; retry++) {
-        int result = esp32_spi_read_burst(hw_handle, dev_addr, start_reg, buffer, len);
+        int result = platform_spi_read_burst(hw_handle, dev_addr, start_reg, buffer, len);
         if (result == 0) {
             return THERMAL_OK;
         }
-        printf("SPI burst read retry %d\n", retry + 1);
+        THERMAL_LOG_WARN("SPI burst read retry %d\n", retry + 1);
     }
     
-    printf("SPI burst read failed after %d retries\n", SPI_MAX_RETRIES);
+    THERMAL_LOG_ERROR("SPI burst read failed after %d retries\n", SPI_MAX_RETRIES);
     return THERMAL_ERR_IO;
 }
 
@@ -80,6 +80,7 @@ thermal_status_t spi_transport_create(thermal_transport_t *transport, void *hw_h
     
     transport->type = THERMAL_TRANSPORT_SPI;
     transport->hw_handle = hw_handle;
+    transport->bus = hw_handle;
     transport->init = spi_init;
     transport->deinit = spi_deinit;
     transport->read_reg = spi_read_reg;
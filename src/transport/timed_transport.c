@@ -0,0 +1,171 @@
+#include "thermal_transport.h"
+#include "platform/platform_hal.h"
+#include <string.h>
+
+/* I2C sends 8 data bits plus an ACK/NACK per byte; START, repeated START and STOP cost about one clock each. */
+#define I2C_CLOCKS_PER_BYTE 9
+#define I2C_CLOCKS_PER_CONDITION 1
+#define SPI_CLOCKS_PER_BYTE 8
+
+static uint64_t wire_time_ns(const thermal_timed_transport_t *timed, uint8_t is_read, size_t len) {
+    const thermal_bus_timing_t *timing = &timed->bus->timing;
+    size_t header_bytes = timed->reg_addr_bytes;
+    uint64_t clocks;
+    size_t bytes;
+
+    if (timed->inner.type == THERMAL_TRANSPORT_I2C) {
+        /* Write: S addr+W reg data P. Read: S addr+W reg Sr addr+R data P. */
+        bytes = 1 + header_bytes + (is_read ? 1 : 0) + len;
+        clocks = (uint64_t)bytes * I2C_CLOCKS_PER_BYTE + (uint64_t)(is_read ? 3 : 2) * I2C_CLOCKS_PER_CONDITION;
+    } else {
+        bytes = header_bytes + len;
+        clocks = (uint64_t)bytes * SPI_CLOCKS_PER_BYTE;
+    }
+
+    return clocks * 1000000000ull / timing->freq_hz + (uint64_t)bytes * timing->stretch_ns + timing->turnaround_ns;
+}
+
+static void charge(thermal_timed_transport_t *timed, uint8_t is_read, size_t len, uint64_t started_us) {
+    thermal_bus_emulator_t *emulator = timed->bus;
+    uint64_t ns = wire_time_ns(timed, is_read, len);
+
+    emulator->clock_ns += ns;
+    emulator->busy_ns += ns;
+    emulator->transactions++;
+    emulator->bytes += (uint32_t)len;
+
+    /* Real-time mode holds the caller for whatever part of the wire time the inner transport did not take. */
+    if (emulator->timing.real_time) {
+        uint64_t spent_us = platform_time_us() - started_us;
+        uint64_t wire_us = ns / 1000;
+        if (wire_us > spent_us) {
+            platform_sleep_us((uint32_t)(wire_us - spent_us));
+        }
+    }
+}
+
+static thermal_status_t timed_init(void *hw_handle) {
+    thermal_timed_transport_t *timed = (thermal_timed_transport_t *)hw_handle;
+    if (!timed) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+    return timed->inner.init(timed->inner.hw_handle);
+}
+
+static thermal_status_t timed_deinit(void *hw_handle) {
+    thermal_timed_transport_t *timed = (thermal_timed_transport_t *)hw_handle;
+    if (!timed) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+    return timed->inner.deinit(timed->inner.hw_handle);
+}
+
+static thermal_status_t timed_read_reg(void *hw_handle, uint8_t dev_addr, uint16_t reg, uint8_t *data, size_t len) {
+    thermal_timed_transport_t *timed = (thermal_timed_transport_t *)hw_handle;
+    if (!timed) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    uint64_t started_us = platform_time_us();
+    thermal_status_t status = timed->inner.read_reg(timed->inner.hw_handle, dev_addr, reg, data, len);
+    charge(timed, 1, len, started_us);
+    return status;
+}
+
+static thermal_status_t timed_write_reg(void *hw_handle, uint8_t dev_addr, uint16_t reg, const uint8_t *data, size_t len) {
+    thermal_timed_transport_t *timed = (thermal_timed_transport_t *)hw_handle;
+    if (!timed) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    uint64_t started_us = platform_time_us();
+    thermal_status_t status = timed->inner.write_reg(timed->inner.hw_handle, dev_addr, reg, data, len);
+    charge(timed, 0, len, started_us);
+    return status;
+}
+
+static thermal_status_t timed_read_burst(void *hw_handle, uint8_t dev_addr, uint16_t start_reg, uint8_t *buffer, size_t len) {
+    thermal_timed_transport_t *timed = (thermal_timed_transport_t *)hw_handle;
+    if (!timed) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    uint64_t started_us = platform_time_us();
+    thermal_status_t status = timed->inner.read_burst(timed->inner.hw_handle, dev_addr, start_reg, buffer, len);
+    charge(timed, 1, len, started_us);
+    return status;
+}
+
+thermal_status_t timed_bus_init(thermal_bus_emulator_t *emulator, const thermal_bus_timing_t *timing) {
+    if (!emulator || !timing || timing->freq_hz == 0) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    memset(emulator, 0, sizeof(*emulator));
+    emulator->timing = *timing;
+    emulator->start_us = platform_time_us();
+
+    return THERMAL_OK;
+}
+
+/* Any number of devices can wrap one emulator; creating a transport leaves the bus statistics alone. */
+thermal_status_t timed_transport_create(thermal_transport_t *transport, thermal_timed_transport_t *timed, thermal_bus_emulator_t *emulator, const thermal_transport_t *inner, uint8_t reg_addr_bytes) {
+    if (!transport || !timed || !emulator || !inner || emulator->timing.freq_hz == 0 || reg_addr_bytes > sizeof(uint16_t)) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    if (!inner->init || !inner->deinit || !inner->read_reg || !inner->write_reg || !inner->read_burst) {
+        return THERMAL_ERR_INVALID_ARG;
+    }
+
+    timed->bus = emulator;
+    timed->inner = *inner;
+    timed->reg_addr_bytes = reg_addr_bytes;
+
+    transport->type = inner->type;
+    transport->hw_handle = timed;
+    transport->bus = inner->bus ? inner->bus : inner->hw_handle;
+    transport->init = timed_init;
+    transport->deinit = timed_deinit;
+    transport->read_reg = timed_read_reg;
+    transport->write_reg = timed_write_reg;
+    transport->read_burst = timed_read_burst;
+
+    return THERMAL_OK;
+}
+
+/* Advances the virtual clock over time the bus sat idle, e.g. the wait between scheduled frames. */
+void timed_transport_idle(thermal_bus_emulator_t *emulator, uint32_t us) {
+    if (emulator) {
+        emulator->clock_ns += (uint64_t)us * 1000;
+    }
+}
+
+void timed_transport_get_stats(const thermal_bus_emulator_t *emulator, thermal_bus_stats_t *stats) {
+    if (!emulator || !stats) {
+        return;
+    }
+
+    stats->busy_us = emulator->busy_ns / 1000;
+    stats->elapsed_us = emulator->timing.real_time ? platform_time_us() - emulator->start_us : emulator->clock_ns / 1000;
+    stats->transactions = emulator->transactions;
+    stats->bytes = emulator->bytes;
+    stats->utilization = stats->elapsed_us ? (float)stats->busy_us / (float)stats->elapsed_us : 0.0f;
+}
+
+void timed_transport_reset_stats(thermal_bus_emulator_t *emulator) {
+    if (!emulator) {
+        return;
+    }
+
+    emulator->clock_ns = 0;
+    emulator->busy_ns = 0;
+    emulator->transactions = 0;
+    emulator->bytes = 0;
+    emulator->start_us = platform_time_us();
+}
+
+/*
+Developed by Brandon | Github; A31A18B25C9D012
+For public use and modification, see LICENSE file in the root of this repository.
+*/
\ No newline at end of file